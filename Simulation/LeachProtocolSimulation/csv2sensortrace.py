@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+#
+# Converts a sensor history CSV into the columnar trace read by
+# LeachSensorTrace (Leach.sensingSource = "trace"):
+#
+#   time,node,temperature,humidity
+#
+# time is in seconds, node is the host index. A header line is skipped.
+#
+# usage: csv2sensortrace.py sensors.csv sensors.bin
+#
+# The CSV is read twice, first to size the per-node row ranges and then to
+# write the rows straight into the memory-mapped output, so the trace never
+# has to fit in memory. Only nodes whose rows are not already in time order
+# are sorted afterwards, one node at a time. Values are written in
+# little-endian byte order (x86, ARM hosts).
+
+import array
+import mmap
+import struct
+import sys
+
+HEADER = struct.Struct("<8sIIQ")
+VERSION = 1
+
+
+def rows(csv_name):
+    with open(csv_name) as f:
+        for line in f:
+            fields = line.strip().split(",")
+            if len(fields) != 4 or not fields[1].strip().isdigit():
+                continue  # header or blank line
+            yield float(fields[0]), int(fields[1]), float(fields[2]), float(fields[3])
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: csv2sensortrace.py sensors.csv sensors.bin")
+    csv_name, out_name = sys.argv[1], sys.argv[2]
+
+    counts = []
+    last_time = []
+    unsorted = set()
+    for time, node, _, _ in rows(csv_name):
+        if node >= len(counts):
+            counts.extend([0] * (node + 1 - len(counts)))
+            last_time.extend([float("-inf")] * (node + 1 - len(last_time)))
+        counts[node] += 1
+        if time < last_time[node]:
+            unsorted.add(node)
+        last_time[node] = time
+
+    node_count = len(counts)
+    offsets = [0]
+    for count in counts:
+        offsets.append(offsets[-1] + count)
+    row_count = offsets[-1]
+
+    columns_start = HEADER.size + 8 * (node_count + 1)
+    size = columns_start + 3 * 8 * row_count
+    with open(out_name, "w+b") as f:
+        f.truncate(size)
+        data = mmap.mmap(f.fileno(), size)
+        HEADER.pack_into(data, 0, b"LEACHSNS", VERSION, node_count, row_count)
+        struct.pack_into("<%dQ" % (node_count + 1), data, HEADER.size, *offsets)
+
+        def column(index):
+            return columns_start + 8 * row_count * index
+
+        cursor = offsets[:-1]
+        for time, node, temperature, humidity in rows(csv_name):
+            row = cursor[node]
+            cursor[node] += 1
+            struct.pack_into("<d", data, column(0) + 8 * row, time)
+            struct.pack_into("<d", data, column(1) + 8 * row, temperature)
+            struct.pack_into("<d", data, column(2) + 8 * row, humidity)
+
+        for node in sorted(unsorted):
+            begin, end = offsets[node], offsets[node + 1]
+            values = []
+            for index in range(3):
+                start = column(index) + 8 * begin
+                values.append(array.array("d", data[start:start + 8 * (end - begin)]))
+            order = sorted(range(end - begin), key=values[0].__getitem__)
+            for index in range(3):
+                start = column(index) + 8 * begin
+                data[start:start + 8 * (end - begin)] = array.array("d", (values[index][i] for i in order)).tobytes()
+
+        data.flush()
+        data.close()
+    print("%d readings of %d nodes written to %s" % (row_count, node_count, out_name))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+#
+# Converts the binary LEACH event trace (eventLog.bin, written by
+# LeachEventTrace) into the eventLog.csv format:
+#
+#   Time,Node,Rx-Tx Node,Packet,Type,Energy,State
+#
+# usage: eventlog2csv.py [eventLog.bin] [eventLog.csv]
+#
+# The trace is written in host byte order; this script assumes a
+# little-endian host (x86, ARM).
+
+import mmap
+import struct
+import sys
+
+RECORD = struct.Struct("<ddiiBBB5x")
+FOOTER = struct.Struct("<QI4s")
+
+PACKETS = ["CTRL", "ACK", "SCH", "DATA", "BS", "BEACON", "STATUS", "ASSIGN"]
+TYPES = ["SENT", "REC"]
+STATES = ["nch", "ch"]
+SPECIAL_NODES = {-1: "Broadcast", -2: "Unknown"}
+
+
+def read_trace(data):
+    if data[:8] != b"LEACHTRC":
+        raise ValueError("not a LEACH event trace")
+    version, record_size = struct.unpack_from("<II", data, 8)
+    if version != 1 or record_size != RECORD.size:
+        raise ValueError("unsupported trace version %d / record size %d" % (version, record_size))
+
+    name_table_offset, node_count, magic = FOOTER.unpack_from(data, len(data) - FOOTER.size)
+    if magic != b"LTND":
+        raise ValueError("trace has no name table, was the simulation terminated early?")
+
+    names = []
+    offset = name_table_offset
+    for _ in range(node_count):
+        (length,) = struct.unpack_from("<I", data, offset)
+        offset += 4
+        names.append(data[offset:offset + length].decode())
+        offset += length
+
+    def node_name(node_id):
+        return SPECIAL_NODES.get(node_id) or names[node_id]
+
+    for offset in range(16, name_table_offset, RECORD.size):
+        time, energy, src, dest, packet, type_, state = RECORD.unpack_from(data, offset)
+        yield time, node_name(src), node_name(dest), PACKETS[packet], TYPES[type_], energy, STATES[state]
+
+
+def main():
+    in_name = sys.argv[1] if len(sys.argv) > 1 else "eventLog.bin"
+    out_name = sys.argv[2] if len(sys.argv) > 2 else "eventLog.csv"
+    # The trace is mapped rather than read, records are decoded as they are written out
+    with open(in_name, "rb") as f, mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as data, open(out_name, "w") as out:
+        out.write("Time,Node,Rx-Tx Node,Packet,Type,Energy,State\n")
+        for time, src, dest, packet, type_, energy, state in read_trace(data):
+            # sent events are listed under the sender, received ones under the receiver;
+            # nanosecond times keep the TDMA slots apart, the energy is written losslessly
+            node, peer = (src, dest) if type_ == "SENT" else (dest, src)
+            out.write("%.9f,%s,%s,%s,%s,%r,%s\n" % (time, node, peer, packet, type_, energy, state))
+
+
+if __name__ == "__main__":
+    main()
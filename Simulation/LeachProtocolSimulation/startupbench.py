@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+#
+# Compares the startup cost of LEACHnode/LEACHbs (LEACHPROTOCOL config)
+# with LEACHnodeLite/LEACHbsLite (LEACHLITE config): module count, peak
+# RSS and wall time of setting up and initializing the network.
+#
+# usage: startupbench.py [-n 100,1000,10000] -- <simulation command>
+#
+# e.g.   startupbench.py -n 1000,10000 -- ../../src/leach -n ../..
+#
+# Every run ends right after initialization (sim-time-limit 1us). The wall
+# time runs from the launch of the process to the initWallClock scalar that
+# leachStatistics records at the first event, so finish() and the result
+# files are not included. The module count is read from the #modules scalar.
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+CONFIGS = ["LEACHPROTOCOL", "LEACHLITE"]
+
+
+def read_scalar(result_dir, scalar):
+    for name in os.listdir(result_dir):
+        if not name.endswith(".sca"):
+            continue
+        with open(os.path.join(result_dir, name)) as f:
+            for line in f:
+                fields = line.split()
+                if len(fields) == 4 and fields[0] == "scalar" and fields[1].endswith("leachStatistics") and fields[2] == scalar:
+                    return float(fields[3])
+    return None
+
+
+def run(command, config, num_nodes):
+    result_dir = tempfile.mkdtemp(prefix="leachstartup")
+    try:
+        args = command + ["-u", "Cmdenv", "-c", config, "--cmdenv-express-mode=true",
+                          "--sim-time-limit=1us", "--*.numNodes=%d" % num_nodes,
+                          "--**.LEACHnode.numNodes=%d" % num_nodes,
+                          "--**.LEACHnode.eventTraceFile=\"\"", "--**.LEACHnode.packetLogFile=\"\"",
+                          "--**.leachStatistics.recordInitTime=true",
+                          "--result-dir=" + result_dir]
+        errors = open(os.path.join(result_dir, "stderr.txt"), "w+")
+        # The simulation reports the end of initialization in wall clock time as well
+        start = time.time()
+        process = subprocess.Popen(args, stdout=subprocess.DEVNULL, stderr=errors)
+        # wait4 gives the resource usage of this child alone
+        _, status, usage = os.wait4(process.pid, 0)
+        process.returncode = os.waitstatus_to_exitcode(status)
+        if process.returncode != 0:
+            errors.seek(0)
+            sys.exit("%s with %d nodes failed:\n%s" % (config, num_nodes, errors.read()))
+        errors.close()
+        modules = read_scalar(result_dir, "#modules")
+        initialized = read_scalar(result_dir, "initWallClock")
+        if modules is None or initialized is None:
+            sys.exit("%s with %d nodes recorded no #modules or initWallClock scalar, is leachStatistics in the network?" % (config, num_nodes))
+        # ru_maxrss is in kilobytes on Linux
+        return int(modules), usage.ru_maxrss / 1024, initialized - start
+    finally:
+        shutil.rmtree(result_dir)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compares the startup cost of the full and the Lite LEACH node types.")
+    parser.add_argument("-n", "--nodes", default="100,1000,10000", help="comma separated node counts")
+    parser.add_argument("command", nargs=argparse.REMAINDER, help="simulation command, after --")
+    options = parser.parse_args()
+    command = options.command[1:] if options.command[:1] == ["--"] else options.command
+    if not command:
+        parser.error("missing simulation command")
+
+    print("nodes,config,modules,rss_mb,init_s")
+    for num_nodes in [int(n) for n in options.nodes.split(",")]:
+        for config in CONFIGS:
+            modules, rss, init = run(command, config, num_nodes)
+            print("%d,%s,%d,%.1f,%.2f" % (num_nodes, config, modules, rss, init))
+            sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,78 @@
+//
+// Wall-time of LeachClusterOptimizer versus node count and cluster count.
+//
+// The optimizer has no OMNeT++ dependency, so this builds from the repository
+// root without INET:
+//
+//   g++ -std=c++17 -O3 -march=native -pthread -I. benchmarks/LeachClusterOptimizerBenchmark.cc inet/routing/leach/LeachClusterOptimizer.cc -o leachClusterBenchmark
+//
+// usage: leachClusterBenchmark [restarts] [threads] [repetitions]
+//
+// Nodes are placed uniformly on a 1000m x 1000m field with uniform residual
+// energy in [0.5, 1] J. Every line reports the median wall-time of the
+// repetitions, with one thread and with the requested number of threads
+// (0 = all cores), as CSV.
+//
+
+#include "inet/routing/leach/LeachClusterOptimizer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+
+using namespace inet;
+
+static double measure(const LeachClusterOptimizer& optimizer, LeachClusterOptimizer::Parameters parameters, int repetitions, LeachClusterOptimizer::Result& result) {
+    std::vector<double> times;
+    for (int i = 0; i < repetitions; i++) {
+        parameters.seed = i;
+        auto start = std::chrono::steady_clock::now();
+        result = optimizer.optimize(parameters);
+        auto end = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+int main(int argc, char **argv) {
+    int restarts = argc > 1 ? atoi(argv[1]) : 8;
+    int threads = argc > 2 ? atoi(argv[2]) : 0;
+    int repetitions = argc > 3 ? atoi(argv[3]) : 5;
+    if (threads <= 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    const int nodeCounts[] = { 100, 1000, 10000, 50000 };
+    const double clusterFractions[] = { 0.01, 0.05, 0.1 };
+
+    printf("nodes,clusters,restarts,iterations,cost,ms_1thread,ms_%dthreads,speedup\n", threads);
+    for (int numNodes : nodeCounts) {
+        std::mt19937_64 rng(numNodes);
+        std::uniform_real_distribution<double> coordinate(0, 1000);
+        std::uniform_real_distribution<double> energy(0.5, 1);
+        LeachClusterOptimizer optimizer;
+        optimizer.reserve(numNodes);
+        for (int i = 0; i < numNodes; i++) {
+            double x = coordinate(rng);
+            double y = coordinate(rng);
+            optimizer.addNode(x, y, energy(rng));
+        }
+
+        for (double fraction : clusterFractions) {
+            LeachClusterOptimizer::Parameters parameters;
+            parameters.numClusters = std::max(1, (int)(fraction * numNodes));
+            parameters.numRestarts = restarts;
+            LeachClusterOptimizer::Result result;
+            parameters.numThreads = 1;
+            double sequential = measure(optimizer, parameters, repetitions, result);
+            parameters.numThreads = threads;
+            double parallel = measure(optimizer, parameters, repetitions, result);
+            printf("%d,%d,%d,%d,%.0f,%.3f,%.3f,%.2f\n", numNodes, (int)result.clusterHeads.size(), restarts, result.iterations, result.cost, sequential, parallel, sequential / parallel);
+            fflush(stdout);
+        }
+    }
+    return 0;
+}
@@ -4,13 +4,14 @@
 #include "inet/linklayer/common/InterfaceTag_m.h"
 #include "inet/networklayer/common/L3AddressTag_m.h"
 #include "inet/routing/leach/Leach.h"
+#include "inet/routing/leach/LeachAddressRegistry.h"
 #include "inet/physicallayer/wireless/common/contract/packetlevel/SignalTag_m.h"
-#include "inet/networklayer/common/L3AddressResolver.h"
 #include "inet/power/storage/SimpleEpEnergyStorage.h"
 #include "inet/mobility/contract/IMobility.h"
 #include "inet/common/geometry/common/Coord.h"
 #include "inet/networklayer/ipv4/Ipv4InterfaceData.h"
 #include <list>
+#include <map>
 #include <vector>
 #include <algorithm>
 #include <ctime>
@@ -22,16 +23,55 @@ namespace inet {
 
 Define_Module(Leach);
 
+simsignal_t Leach::subIntervalTotSignal = registerSignal("subIntervalTot");
+simsignal_t Leach::leachStateChangedSignal = registerSignal("leachStateChanged");
+simsignal_t Leach::packetSentSignals[] = {
+    registerSignal("ctrlPktSent"), registerSignal("ackPktSent"), registerSignal("schPktSent"), registerSignal("dataPktSent"),
+    registerSignal("bsPktSent"), registerSignal("beaconPktSent"), registerSignal("statusPktSent"), registerSignal("assignPktSent")
+};
+simsignal_t Leach::packetReceivedSignals[] = {
+    registerSignal("ctrlPktReceived"), registerSignal("ackPktReceived"), registerSignal("schPktReceived"), registerSignal("dataPktReceived"),
+    registerSignal("bsPktReceived"), registerSignal("beaconPktReceived"), registerSignal("statusPktReceived"), registerSignal("assignPktReceived")
+};
+simsignal_t Leach::bsPktRelayedSignal = registerSignal("bsPktRelayed");
+simsignal_t Leach::readingSensedSignal = registerSignal("readingSensed");
+simsignal_t Leach::residualEnergySignal = registerSignal("residualEnergy");
+simsignal_t Leach::sensingQueueLengthSignal = registerSignal("sensingQueueLength");
+simsignal_t Leach::readingDroppedSignal = registerSignal("readingDropped");
+simsignal_t Leach::hopDelaySignal = registerSignal("hopDelay");
+
 Leach::ForwardEntry::~ForwardEntry() {
     if (this->event != nullptr) delete this->event;
     if (this->hello != nullptr) delete this->hello;
 }
 
+// Every node appends its rows to the one packet log of its file name; the
+// first node to initialize truncates the file, the last one to finish closes it
+struct LeachSharedPacketLog {
+    std::ofstream file;
+    int refCount = 0;
+};
+
+static std::map<std::string, LeachSharedPacketLog> sharedPacketLogs;
+
 Leach::Leach() : event(nullptr), forwardEntry(nullptr) {}
 
 Leach::~Leach() {
-    stop();
-    delete event;
+    // No stop() here, setLeachState() would emit from a module being deleted
+    cancelAndDelete(event);
+    cancelAndDelete(energySampleTimer);
+    cancelAndDelete(aggregationTimer);
+    cancelAndDelete(scheduleTimer);
+    cancelAndDelete(joinTimer);
+    cancelAndDelete(dataTimer);
+    cancelAndDelete(sleepTimer);
+    cancelAndDelete(wakeTimer);
+    cancelAndDelete(sensingTimer);
+    if (eventTrace != nullptr)
+        eventTrace->release();
+    if (sensorTrace != nullptr)
+        sensorTrace->release();
+    releasePacketLog();
 }
 
 void Leach::initialize(int stage) {
@@ -40,31 +80,149 @@ void Leach::initialize(int stage) {
     if (stage == INITSTAGE_LOCAL) {
         sequencenumber = 0;
         host = getContainingNode(this);
+        energyStorage = dynamic_cast<SimpleEpEnergyStorage *>(host->getSubmodule("energyStorage"));
+        if (energyStorage == nullptr)
+            EV_WARN << "No SimpleEpEnergyStorage found in " << host->getFullName() << ", residual energy is reported as 0" << endl;
+        LeachAddressRegistry::getInstance().invalidate();
         ift = getModuleFromPar<IInterfaceTable>(par("interfaceTableModule"), this);
 
         clusterHeadPercentage = par("clusterHeadPercentage");
         numNodes = par("numNodes");
+        const char *electionPolicyPar = par("electionPolicy");
+        if (!strcmp(electionPolicyPar, "classic"))
+            electionPolicy = ELECTION_CLASSIC;
+        else if (!strcmp(electionPolicyPar, "energy"))
+            electionPolicy = ELECTION_ENERGY;
+        else if (!strcmp(electionPolicyPar, "quota"))
+            electionPolicy = ELECTION_QUOTA;
+        else if (!strcmp(electionPolicyPar, "sep"))
+            electionPolicy = ELECTION_SEP;
+        else
+            throw cRuntimeError("Unknown electionPolicy '%s'", electionPolicyPar);
+        if (electionPolicy == ELECTION_QUOTA && (!host->isVector() || numNodes != host->getVectorSize()))
+            throw cRuntimeError("The quota election requires numNodes (%d) to match the size of the host vector", numNodes);
+        const char *energyClassPar = par("energyClass");
+        if (!strcmp(energyClassPar, "normal"))
+            energyClass = LEACH_ENERGY_NORMAL;
+        else if (!strcmp(energyClassPar, "advanced"))
+            energyClass = LEACH_ENERGY_ADVANCED;
+        else
+            throw cRuntimeError("Unknown energyClass '%s'", energyClassPar);
+        advancedFraction = par("advancedFraction");
+        advancedEnergyFactor = par("advancedEnergyFactor");
+        electionEpoch = getElectionEpoch();
+        statistics = findModuleFromPar<LeachStatistics>(par("statisticsModule"), this);
+        if (statistics != nullptr)
+            statistics->registerNode(energyClass);
+
+        const char *eventTraceFile = par("eventTraceFile");
+        if (*eventTraceFile)
+            eventTrace = LeachEventTrace::acquire(eventTraceFile);
+        packetLogFile = par("packetLogFile").stdstringValue();
+        if (!packetLogFile.empty()) {
+            LeachSharedPacketLog& sharedLog = sharedPacketLogs[packetLogFile];
+            if (sharedLog.refCount++ == 0) {
+                sharedLog.file.open(packetLogFile);
+                if (!sharedLog.file)
+                    throw cRuntimeError("Cannot open packet log file '%s'", packetLogFile.c_str());
+                sharedLog.file << "PacketId,Source,Round,Sequence" << std::endl;
+            }
+        }
 
-        dataPktSent = 0;
-        dataPktReceived = 0;
-        dataPktReceivedVerf = 0;
-        controlPktSent = 0;
-        controlPktReceived = 0;
-        bsPktSent = 0;
-        totalChCount = 0;
 
         dataPktSendDelay = uniform(0, 10);
         CHPktSendDelay = par("CHPktSendDelay");
         roundDuration = par("roundDuration");
-
-        TDMADelayCounter = 1;
+        joinWindow = par("joinWindow");
+        advertisementWindow = par("advertisementWindow");
+        if (advertisementWindow >= joinWindow)
+            throw cRuntimeError("advertisementWindow must be shorter than joinWindow, otherwise ACKs miss the CH join window");
+        // Nodes start their rounds up to maxVariance apart, a join before the own round start would be reset by it
+        if (advertisementWindow < par("maxVariance").doubleValue())
+            throw cRuntimeError("advertisementWindow must not be shorter than maxVariance, otherwise nodes join before their own round starts");
+
+        TDMADelayCounter = 0;
+
+        bitrate = par("bitrate");
+        slotPacketLength = B(par("slotPacketLength").intValue());
+        slotGuardTime = par("slotGuardTime");
+        slotDuration = getAirtime(slotPacketLength);
+        maxFramesPerRound = par("maxFramesPerRound");
 
         helloInterval = par("helloInterval");
         event = new cMessage("event");
+        aggregationTimer = new cMessage("aggregation", DATA2BS);
+        scheduleTimer = new cMessage("schedule", SCHEDULE);
+        joinTimer = new cMessage("join", JOIN);
+        dataTimer = new cMessage("data", DATA2CH);
+        sleepTimer = new cMessage("radioSleep", RADIO_SLEEP);
+        wakeTimer = new cMessage("radioWake", RADIO_WAKE);
+        dutyCycling = par("dutyCycling");
+        multiHop = par("multiHop");
+        const char *baseStationAddressPar = par("baseStationAddress");
+        if (*baseStationAddressPar)
+            baseStationAddress = Ipv4Address(baseStationAddressPar);
+        sinkTimeout = par("sinkTimeout");
+        const char *clusteringModePar = par("clusteringMode");
+        if (!strcmp(clusteringModePar, "distributed"))
+            clusteringMode = CLUSTERING_DISTRIBUTED;
+        else if (!strcmp(clusteringModePar, "centralized"))
+            clusteringMode = CLUSTERING_CENTRALIZED;
+        else
+            throw cRuntimeError("Unknown clusteringMode '%s'", clusteringModePar);
+        const char *sinkSelectionPar = par("sinkSelection");
+        if (!strcmp(sinkSelectionPar, "distance"))
+            sinkSelection = SINK_DISTANCE;
+        else if (!strcmp(sinkSelectionPar, "rssi"))
+            sinkSelection = SINK_RSSI;
+        else
+            throw cRuntimeError("Unknown sinkSelection '%s'", sinkSelectionPar);
+        backboneCHs.reserve(numNodes);
+        backboneIndex.reserve(numNodes);
+
+        const char *sensingSourcePar = par("sensingSource");
+        if (!strcmp(sensingSourcePar, "none"))
+            sensingSource = SENSING_NONE;
+        else if (!strcmp(sensingSourcePar, "periodic"))
+            sensingSource = SENSING_PERIODIC;
+        else if (!strcmp(sensingSourcePar, "poisson"))
+            sensingSource = SENSING_POISSON;
+        else if (!strcmp(sensingSourcePar, "trace"))
+            sensingSource = SENSING_TRACE;
+        else
+            throw cRuntimeError("Unknown sensingSource '%s'", sensingSourcePar);
+        sensingInterval = par("sensingInterval");
+        sensingQueueCapacity = par("sensingQueueCapacity").intValue();
+        if (sensingSource == SENSING_TRACE) {
+            sensorTrace = LeachSensorTrace::acquire(par("sensingTraceFile"));
+            sensingTraceIndex = sensorTrace->getBegin(host->getIndex());
+            sensingTraceEnd = sensorTrace->getEnd(host->getIndex());
+            EV_INFO << "Sensor trace has " << sensingTraceEnd - sensingTraceIndex << " readings for " << host->getFullName() << endl;
+        }
+        if (sensingSource != SENSING_NONE)
+            sensingTimer = new cMessage("sensing", SENSE);
+        WATCH(readingsSensed);
+        WATCH(readingsDropped);
+
+        const char *aggregationFunctionPar = par("aggregationFunction");
+        if (!strcmp(aggregationFunctionPar, "mean"))
+            aggregationFunction = AGGREGATE_MEAN;
+        else if (!strcmp(aggregationFunctionPar, "min"))
+            aggregationFunction = AGGREGATE_MIN;
+        else if (!strcmp(aggregationFunctionPar, "max"))
+            aggregationFunction = AGGREGATE_MAX;
+        else if (!strcmp(aggregationFunctionPar, "count"))
+            aggregationFunction = AGGREGATE_COUNT;
+        else
+            throw cRuntimeError("Unknown aggregationFunction '%s'", aggregationFunctionPar);
+        aggregatedPacketIds.reserve(numNodes);
+
+        energySamplingInterval = par("energySamplingInterval");
+        if (energySamplingInterval > 0)
+            energySampleTimer = new cMessage("energySample", ENERGY_SAMPLE);
 
         WATCH(threshold);
         WATCH(round);
-        WATCH(totalChCount);
 
         round = 0;
         weight = 0;
@@ -75,13 +233,31 @@ void Leach::initialize(int stage) {
         // Reserve memory for vectors
         nodeMemory.reserve(numNodes);
         nodeCHMemory.reserve(numNodes);
+        nodeCHIndex.reserve(numNodes);
         extractedTDMASchedule.reserve(numNodes);
     } else if (stage == INITSTAGE_ROUTING_PROTOCOLS) {
         registerService(Protocol::manet, gate("ipOut"), gate("ipIn"));
         registerProtocol(Protocol::manet, gate("ipOut"), gate("ipIn"));
+
+        // The radio is only driven when duty cycling, but its modes are always accounted
+        cModule *radioModule = host->findModuleByPath(par("radioModule"));
+        radio = dynamic_cast<physicallayer::IRadio *>(radioModule);
+        if (radio != nullptr) {
+            lastRadioMode = radio->getRadioMode();
+            lastRadioModeChange = simTime();
+            radioModule->subscribe(physicallayer::IRadio::radioModeChangedSignal, this);
+        } else if (dutyCycling) {
+            throw cRuntimeError("Duty cycling requires a radio at '%s'", par("radioModule").stringValue());
+        }
     }
 }
 void Leach::start() {
+    if (initialEnergy == 0)
+        initialEnergy = getResidualEnergy();
+    if (reportedDown) {
+        statistics->nodeUp(host, energyClass);
+        reportedDown = false;
+    }
     addToNodePosList();
 
     int num_802154 = 0;
@@ -108,19 +284,124 @@ void Leach::start() {
 
     event->setKind(SELF);
     scheduleAt(simTime() + uniform(0.0, par("maxVariance").doubleValue()), event);
+
+    if (energySampleTimer != nullptr)
+        scheduleAt(simTime(), energySampleTimer);
+    if (sensingTimer != nullptr)
+        scheduleNextReading();
 }
 
 void Leach::stop() {
     cancelEvent(event);
+    if (aggregationTimer != nullptr)
+        cancelEvent(aggregationTimer);
+    if (scheduleTimer != nullptr)
+        cancelEvent(scheduleTimer);
+    if (joinTimer != nullptr)
+        cancelEvent(joinTimer);
+    if (dataTimer != nullptr)
+        cancelEvent(dataTimer);
+    if (sleepTimer != nullptr)
+        cancelEvent(sleepTimer);
+    if (wakeTimer != nullptr)
+        cancelEvent(wakeTimer);
+    if (sensingTimer != nullptr)
+        cancelEvent(sensingTimer);
+    sensingQueue.clear();
+    idealCH = Ipv4Address::UNSPECIFIED_ADDRESS;
+    aggregatedPacketIds.clear();
+    if (energySampleTimer != nullptr)
+        cancelEvent(energySampleTimer);
     nodeMemory.clear();
     nodeCHMemory.clear();
+    nodeCHIndex.clear();
     extractedTDMASchedule.clear();
-    TDMADelayCounter = 1;
+    TDMADelayCounter = 0;
+    backboneCHs.clear();
+    backboneIndex.clear();
+    nextHop = Ipv4Address::UNSPECIFIED_ADDRESS;
     setLeachState(nch);
 }
 
 void Leach::handleMessageWhenUp(cMessage *msg) {
-    if (msg->isSelfMessage()) {
+    if (msg == energySampleTimer) {
+        sampleResidualEnergy();
+        scheduleAfter(energySamplingInterval, energySampleTimer);
+    } else if (msg == sensingTimer) {
+        senseReading();
+        scheduleNextReading();
+    } else if (msg == aggregationTimer) {
+        // end of the member slots, one uplink carries everything sent in this frame
+        // together with the CH's own readings
+        SensorReading reading;
+        while (takeReading(reading)) {
+            LeachPacketId packetId = generatePacketId();
+            addToPacketLog(packetId);
+            addToAggregation(packetId, reading.temperature, reading.humidity);
+        }
+        sendDataToBS(interface80211ptr->getProtocolData<Ipv4InterfaceData>()->getIPAddress());
+        if (++currentFrame < numFrames)
+            scheduleAt(frameStart + currentFrame * frameDuration + slotOffset, aggregationTimer);
+        else if (!multiHop)  // a backbone CH keeps relaying for farther CHs until the next setup
+            sleepUntilNextSetup(simTime() + frameDuration - slotOffset);
+    } else if (msg == dataTimer) {
+        // Members only wake for their own slot, and only if there is a reading to send
+        SensorReading reading;
+        if (takeReading(reading)) {
+            wakeRadio();
+            sendDataToCH(interface80211ptr->getProtocolData<Ipv4InterfaceData>()->getIPAddress(), idealCH, reading);
+        }
+        if (++currentFrame < numFrames) {
+            scheduleAt(frameStart + currentFrame * frameDuration + slotOffset, dataTimer);
+            if (dutyCycling)
+                rescheduleAfter(slotDuration, sleepTimer);
+        } else {
+            sleepUntilNextSetup(simTime() + slotDuration);
+        }
+    } else if (msg == sleepTimer) {
+        sleepRadio();
+    } else if (msg == wakeTimer) {
+        wakeRadio();
+    } else if (msg == scheduleTimer) {
+        // join window closed, announce the complete schedule once
+        EV << "CH " << host->getFullName() << " join window closed with " << nodeCHMemory.size() << " members" << endl;
+        if (statistics != nullptr)
+            statistics->clusterFormed(nodeCHMemory.size());
+        if (multiHop)
+            selectNextHop();
+        startSteadyState(interface80211ptr->getProtocolData<Ipv4InterfaceData>()->getIPAddress());
+    } else if (msg == joinTimer) {
+        joinIdealCH();
+    } else if (msg->isSelfMessage()) {
+        cancelEvent(scheduleTimer);
+        cancelEvent(dataTimer);
+        cancelEvent(sleepTimer);
+        cancelEvent(wakeTimer);
+        wakeRadio();
+        idealCH = Ipv4Address::UNSPECIFIED_ADDRESS;
+        nextHop = Ipv4Address::UNSPECIFIED_ADDRESS;
+        emit(subIntervalTotSignal, (intval_t)round);
+        if (statistics != nullptr)
+            statistics->roundStarted(round);
+
+        // Advertisements heard up to maxVariance ago already belong to this round
+        simtime_t backboneHorizon = simTime() - par("maxVariance").doubleValue();
+        backboneCHs.erase(std::remove_if(backboneCHs.begin(), backboneCHs.end(),
+                [&] (const BackboneEntry& entry) { return entry.heardAt < backboneHorizon; }), backboneCHs.end());
+        backboneIndex.clear();
+        for (size_t i = 0; i < backboneCHs.size(); i++)
+            backboneIndex.insert(backboneCHs[i].address, i);
+        relayedSinkDistance = roundRelayedSinkDistance;
+        roundRelayedSinkDistance = INFINITY;
+        for (auto& entry : backboneCHs)
+            roundRelayedSinkDistance = std::min(roundRelayedSinkDistance, getPosition().distance(entry.position) + entry.sinkDistance);
+
+        // Readings still buffered from the previous round are not carried over
+        cancelEvent(aggregationTimer);
+        if (!aggregatedPacketIds.empty()) {
+            sendDataToBS(interface80211ptr->getProtocolData<Ipv4InterfaceData>()->getIPAddress());
+        }
+
         // Timeout check for CHs
                 if (leachState == ch && simTime() >= roundStartTime + roundDuration) {
                     EV << "Node " << host->getFullName() << " CH timeout, reverting to NCH" << endl;
@@ -131,38 +412,36 @@ void Leach::handleMessageWhenUp(cMessage *msg) {
                     setLeachState(nch);
                 }
 
-        double randNo = uniform(0, 1);
-        threshold = generateThresholdValue(round);
-
-        if (randNo < threshold && !wasCH) {
-            weight++;
-            setLeachState(ch);
-            wasCH = true;
-            handleSelfMessage(msg);
+        if (clusteringMode == CLUSTERING_CENTRALIZED) {
+            // The BS assigns the roles of this round, see processAssignment()
+            sendStatusToBS(interface80211ptr->getProtocolData<Ipv4InterfaceData>()->getIPAddress());
+        } else {
+            if (electClusterHead()) {
+                weight++;
+                if (statistics != nullptr)
+                    statistics->clusterHeadElected(energyClass);
+                setLeachState(ch);
+                wasCH = true;
+                // A CH does not join another cluster
+                cancelEvent(joinTimer);
+                nodeMemory.clear();
+                handleSelfMessage(msg);
+            }
         }
 
+        roundsNotCH = leachState == ch ? 0 : roundsNotCH + 1;
         round++;
-        int intervalLength = 1.0 / clusterHeadPercentage;
-        if (fmod(round, intervalLength) == 0) {
+        sequencenumber = 0;
+        // nodeMemory is kept: advertisements of CHs that started this round earlier
+        // are waiting for joinIdealCH(), which clears it itself
+        if (round % electionEpoch == 0) {
             wasCH = false;
-            nodeMemory.clear();
             nodeCHMemory.clear();
+            nodeCHIndex.clear();
             extractedTDMASchedule.clear();
-            TDMADelayCounter = 1;
+            TDMADelayCounter = 0;
         }
 
-        // Log CH count for debugging
-                static int chCount = 0;
-                if (leachState == ch) chCount++;
-
-                // Move the reset to the start of a new round
-                if (fmod(round, intervalLength) == 0) {
-                    EV << "End of interval, resetting CH count from " << chCount << endl;
-                    chCount = 0;
-                }
-
-                EV << "Round " << round << ": Total CHs = " << chCount << " at " << simTime() << endl;
-
         roundStartTime = simTime();
         event->setKind(SELF);
         scheduleAt(simTime() + roundDuration, event);
@@ -177,11 +456,19 @@ void Leach::handleMessageWhenUp(cMessage *msg) {
 
 void Leach::handleSelfMessage(cMessage *msg) {
     if (msg == event && event->getKind() == SELF) {
-        auto ctrlPkt = makeShared<LeachControlPkt>();
+        auto ctrlPkt = makeShared<LeachAdvPkt>();
         ctrlPkt->setPacketType(CH);
         Ipv4Address source = interface80211ptr->getProtocolData<Ipv4InterfaceData>()->getIPAddress();
-        ctrlPkt->setChunkLength(b(128));
+        // The position and the sink are only needed (and only sent) for the multi-hop backbone
+        ctrlPkt->setChunkLength(b(multiHop ? 128 + 64 + 64 : 128));
         ctrlPkt->setSrcAddress(source);
+        if (multiHop) {
+            const SinkEntry *sink;
+            ctrlPkt->setPosition(getPosition());
+            ctrlPkt->setSinkDistance(getSinkDistance(sink));
+            if (sink != nullptr)
+                ctrlPkt->setSinkAddress(sink->address);
+        }
 
         auto packet = new Packet("LEACHControlPkt", ctrlPkt);
         auto addressReq = packet->addTag<L3AddressReq>();
@@ -191,9 +478,14 @@ void Leach::handleSelfMessage(cMessage *msg) {
         packet->addTag<PacketProtocolTag>()->setProtocol(&Protocol::manet);
         packet->addTag<DispatchProtocolReq>()->setProtocol(&Protocol::ipv4);
 
+        // Members of an earlier CH round must not keep their slots
+        nodeCHMemory.clear();
+        nodeCHIndex.clear();
+        TDMADelayCounter = 0;
+
         send(packet, "ipOut");
-        addToEventLog(source, Ipv4Address(255, 255, 255, 255), "CTRL", "SENT");
-        controlPktSent++;
+        addToEventLog(source, Ipv4Address(255, 255, 255, 255), TRACE_CTRL, TRACE_SENT);
+        scheduleAfter(joinWindow, scheduleTimer);
         bubble("Sending new enrolment message");
     } else {
         delete msg;
@@ -210,138 +502,202 @@ void Leach::processMessage(cMessage *msg) {
 
     if (msg->arrivedOn("ipIn")) {
         if (packetType == CH) {
-            controlPktReceived++;
             Ipv4Address CHAddr = receivedCtrlPkt->getSrcAddress();
-            addToEventLog(CHAddr, selfAddr, "CTRL", "REC");
-
-            auto signalPowerInd = receivedPkt->getTag<SignalPowerInd>();
-            double rxPower = signalPowerInd->getPower().get();
-
-            addToNodeMemory(selfAddr, CHAddr, rxPower);
-            sendAckToCH(selfAddr, CHAddr);
+            addToEventLog(CHAddr, selfAddr, TRACE_CTRL, TRACE_REC);
+
+            // Every node keeps track of the CHs, it may become a CH itself later in the round
+            if (multiHop)
+                addToBackbone(dynamicPtrCast<LeachAdvPkt>(receivedCtrlPkt).get());
+
+            if (leachState == ch || !idealCH.isUnspecified()) {
+                EV << "Node " << host->getFullName() << " ignoring advertisement of " << CHAddr << endl;
+            } else {
+                auto signalPowerInd = receivedPkt->getTag<SignalPowerInd>();
+                double rxPower = signalPowerInd->getPower().get();
+
+                // Advertisements are collected first, the node joins only the best CH
+                addToNodeMemory(selfAddr, CHAddr, rxPower);
+                if (!joinTimer->isScheduled())
+                    scheduleAfter(advertisementWindow, joinTimer);
+            }
         } else if (packetType == ACK && leachState == ch) {
             Ipv4Address nodeAddr = receivedCtrlPkt->getSrcAddress();
-            addToEventLog(nodeAddr, selfAddr, "ACK", "REC");
-
-            addToNodeCHMemory(nodeAddr);
-            EV << "CH " << host->getFullName() << " nodeCHMemory size: " << nodeCHMemory.size() << endl;
-            if (nodeCHMemory.size() >= 1) { // Lowered threshold
-                sendSchToNCH(selfAddr);
+            addToEventLog(nodeAddr, selfAddr, TRACE_ACK, TRACE_REC);
+
+            // The schedule is broadcast once when the join window closes
+            if (scheduleTimer->isScheduled()) {
+                addToNodeCHMemory(nodeAddr);
+                EV << "CH " << host->getFullName() << " nodeCHMemory size: " << nodeCHMemory.size() << endl;
+            } else {
+                EV << "CH " << host->getFullName() << " ignoring late ACK from " << nodeAddr << endl;
             }
         } else if (packetType == SCH) {
             Ipv4Address CHAddr = receivedCtrlPkt->getSrcAddress();
-            addToEventLog(CHAddr, selfAddr, "SCH", "REC");
-
-            int scheduleArraySize = receivedCtrlPkt->getScheduleArraySize();
-            for (int counter = 0; counter < scheduleArraySize; counter++) {
-                ScheduleEntry tempScheduleEntry = receivedCtrlPkt->getSchedule(counter);
-                TDMAScheduleEntry extractedTDMAScheduleEntry;
-                extractedTDMAScheduleEntry.nodeAddress = tempScheduleEntry.getNodeAddress();
-                extractedTDMAScheduleEntry.TDMAdelay = tempScheduleEntry.getTDMAdelay();
-                extractedTDMASchedule.push_back(extractedTDMAScheduleEntry);
-            }
+            addToEventLog(CHAddr, selfAddr, TRACE_SCH, TRACE_REC);
+            // Schedules of other clusters are overheard but not needed
+            if (CHAddr == idealCH) {
+                // Only the latest schedule is relevant
+                extractedTDMASchedule.clear();
+                int scheduleArraySize = receivedCtrlPkt->getScheduleArraySize();
+                for (int counter = 0; counter < scheduleArraySize; counter++) {
+                    ScheduleEntry tempScheduleEntry = receivedCtrlPkt->getSchedule(counter);
+                    TDMAScheduleEntry extractedTDMAScheduleEntry;
+                    extractedTDMAScheduleEntry.nodeAddress = tempScheduleEntry.getNodeAddress();
+                    extractedTDMAScheduleEntry.TDMAdelay = tempScheduleEntry.getTDMAdelay();
+                    extractedTDMASchedule.push_back(extractedTDMAScheduleEntry);
+                }
 
-            double receivedTDMADelay = -1;
-            for (auto& it : extractedTDMASchedule) {
-                if (it.nodeAddress == selfAddr) {
-                    receivedTDMADelay = it.TDMAdelay;
-                    break;
+                double receivedTDMADelay = -1;
+                for (auto& it : extractedTDMASchedule) {
+                    if (it.nodeAddress == selfAddr) {
+                        receivedTDMADelay = it.TDMAdelay;
+                        break;
+                    }
                 }
-            }
 
-            if (receivedTDMADelay > -1) {
-                sendDataToCH(selfAddr, CHAddr, receivedTDMADelay);
+                // Transmit in the own slot of every frame of the steady-state phase
+                if (receivedTDMADelay > -1) {
+                    auto schedulePkt = dynamicPtrCast<LeachSchedulePkt>(receivedCtrlPkt);
+                    frameStart = schedulePkt->getFrameStart();
+                    frameDuration = schedulePkt->getFrameDuration();
+                    numFrames = schedulePkt->getNumFrames();
+                    slotOffset = receivedTDMADelay;
+                    // A schedule delayed by the MAC may arrive after the own slot of the first frame
+                    currentFrame = 0;
+                    while (currentFrame < numFrames && frameStart + currentFrame * frameDuration + slotOffset < simTime())
+                        currentFrame++;
+                    if (currentFrame < numFrames) {
+                        rescheduleAt(frameStart + currentFrame * frameDuration + slotOffset, dataTimer);
+                        sleepRadio();
+                    }
+                }
             }
         } else if (packetType == DATA) {
             Ipv4Address NCHAddr = receivedCtrlPkt->getSrcAddress();
-            addToEventLog(NCHAddr, selfAddr, "DATA", "REC");
-            std::string fingerprint = receivedCtrlPkt->getFingerprint();
-
-            if (checkFingerprint(fingerprint)) {
-                dataPktReceivedVerf++;
-            }
-            dataPktReceived++;
-            sendDataToBS(selfAddr, fingerprint);
+            addToEventLog(NCHAddr, selfAddr, TRACE_DATA, TRACE_REC);
+            auto dataPkt = dynamicPtrCast<LeachDataPkt>(receivedCtrlPkt);
+            // Duplicates are detected by the sink, which sees the ids of all CHs
+            addToAggregation(dataPkt->getPacketId(), dataPkt->getTemperature(), dataPkt->getHumidity());
         } else if (packetType == BS) {
-            delete msg;
+            // Aggregate of a farther CH that chose this node as its next hop
+            auto bsPkt = dynamicPtrCast<LeachBSPkt>(receivedCtrlPkt);
+            addToEventLog(receivedPkt->getTag<L3AddressInd>()->getSrcAddress().toIpv4(), selfAddr, TRACE_BS, TRACE_REC);
+            relayToBS(bsPkt, selfAddr);
+        } else if (packetType == BEACON) {
+            auto beaconPkt = dynamicPtrCast<LeachBeaconPkt>(receivedCtrlPkt);
+            addToEventLog(beaconPkt->getSrcAddress(), selfAddr, TRACE_BEACON, TRACE_REC);
+            addToSinks(beaconPkt->getSrcAddress(), beaconPkt->getPosition(), receivedPkt->getTag<SignalPowerInd>()->getPower().get());
+        } else if (packetType == ASSIGN && clusteringMode == CLUSTERING_CENTRALIZED) {
+            auto assignPkt = dynamicPtrCast<LeachAssignPkt>(receivedCtrlPkt);
+            addToEventLog(assignPkt->getSrcAddress(), selfAddr, TRACE_ASSIGN, TRACE_REC);
+            processAssignment(assignPkt, selfAddr);
         }
+        delete msg;
     } else {
         throw cRuntimeError("Message arrived on unknown gate %s", msg->getArrivalGate()->getName());
     }
 }
 
 void Leach::handleStopOperation(LifecycleOperation *operation) {
-    cancelEvent(event);
+    stop();
+    sampleResidualEnergy();
+    reportDown();
 }
 
 void Leach::handleCrashOperation(LifecycleOperation *operation) {
-    cancelEvent(event);
+    stop();
+    reportDown();
 }
 
-double Leach::generateThresholdValue(int round) {
-    int intervalLength = 1.0 / clusterHeadPercentage;
-    double thresholdVal = clusterHeadPercentage / (1 - clusterHeadPercentage * fmod(round, intervalLength));
-    if (thresholdVal >= 1) {
-        round = 0;
+void Leach::reportDown() {
+    if (statistics != nullptr && !reportedDown) {
+        statistics->nodeDown(host, energyClass);
+        reportedDown = true;
     }
-    return thresholdVal;
 }
 
-// Add checks when adding elements:
-void Leach::addToNodeMemory(Ipv4Address nodeAddr, Ipv4Address CHAddr, double energy) {
-    if (!isCHAddedInMemory(CHAddr)) {
-        if (nodeMemory.size() >= nodeMemory.capacity()) {
-            EV << "Warning: nodeMemory exceeding reserved capacity" << endl;
-        }
-        nodeMemoryObject node;
-        node.nodeAddr = nodeAddr;
-        node.CHAddr = CHAddr;
-        node.energy = energy;
-        nodeMemory.push_back(node);
+template<typename Policy>
+bool Leach::electClusterHead(const LeachElectionContext& context) {
+    double randNo = Policy::randomized ? uniform(0, 1) : 0;
+    threshold = Policy::getThreshold(context);
+    return Policy::isElected(context, threshold, randNo);
+}
+
+LeachElectionContext Leach::getElectionContext() const {
+    LeachElectionContext context;
+    context.round = round;
+    context.clusterHeadPercentage = clusterHeadPercentage;
+    context.intervalLength = 1.0 / clusterHeadPercentage;
+    context.wasCH = wasCH;
+    context.roundsNotCH = roundsNotCH;
+    context.residualEnergy = getResidualEnergy();
+    context.initialEnergy = initialEnergy;
+    context.nodeIndex = host->getIndex();
+    context.numNodes = numNodes;
+    context.energyClass = energyClass;
+    context.advancedFraction = advancedFraction;
+    context.advancedEnergyFactor = advancedEnergyFactor;
+    return context;
+}
+
+int Leach::getElectionEpoch() const {
+    LeachElectionContext context = getElectionContext();
+    switch (electionPolicy) {
+        case ELECTION_CLASSIC: return LeachClassicElection::getEpochLength(context);
+        case ELECTION_ENERGY: return LeachEnergyElection::getEpochLength(context);
+        case ELECTION_QUOTA: return LeachQuotaElection::getEpochLength(context);
+        case ELECTION_SEP: return LeachSepElection::getEpochLength(context);
+    }
+    throw cRuntimeError("Unknown election policy %d", electionPolicy);
+}
+
+bool Leach::electClusterHead() {
+    LeachElectionContext context = getElectionContext();
+    switch (electionPolicy) {
+        case ELECTION_CLASSIC: return electClusterHead<LeachClassicElection>(context);
+        case ELECTION_ENERGY: return electClusterHead<LeachEnergyElection>(context);
+        case ELECTION_QUOTA: return electClusterHead<LeachQuotaElection>(context);
+        case ELECTION_SEP: return electClusterHead<LeachSepElection>(context);
     }
+    throw cRuntimeError("Unknown election policy %d", electionPolicy);
+}
+
+// nodeMemory only holds advertisements received by this node, so nodeAddr is implied
+void Leach::addToNodeMemory(Ipv4Address nodeAddr, Ipv4Address CHAddr, double energy) {
+    nodeMemory.add(CHAddr, energy);
 }
 
 void Leach::addToNodeCHMemory(Ipv4Address NCHAddr) {
-    if (!isNCHAddedInCHMemory(NCHAddr)) {
+    if (nodeCHIndex.insert(NCHAddr, nodeCHMemory.size()).second) {
+        // Slots are assigned by generateTDMASchedule once the join window closes
         TDMAScheduleEntry scheduleEntry;
         scheduleEntry.nodeAddress = NCHAddr;
-        scheduleEntry.TDMAdelay = TDMADelayCounter;
+        scheduleEntry.TDMAdelay = 0;
         nodeCHMemory.push_back(scheduleEntry);
-        TDMADelayCounter++;
     }
 }
 
 bool Leach::isCHAddedInMemory(Ipv4Address CHAddr) {
-    for (auto& it : nodeMemory) {
-        if (it.CHAddr == CHAddr) return true;
-    }
-    return false;
+    return nodeMemory.contains(CHAddr);
 }
 
 bool Leach::isNCHAddedInCHMemory(Ipv4Address NCHAddr) {
-    for (auto& it : nodeCHMemory) {
-        if (it.nodeAddress == NCHAddr) return true;
-    }
-    return false;
+    return nodeCHIndex.contains(NCHAddr);
 }
 
 void Leach::generateTDMASchedule() {
-    // Clear previous schedule
-    nodeCHMemory.clear();
-    TDMADelayCounter = 1.0;
-
-    // Get all nodes that have acknowledged this CH
-    for (auto& node : nodeMemory) {
-        if (node.CHAddr == interface80211ptr->getProtocolData<Ipv4InterfaceData>()->getIPAddress()) {
-            TDMAScheduleEntry scheduleEntry;
-            scheduleEntry.nodeAddress = node.nodeAddr;
-            scheduleEntry.TDMAdelay = TDMADelayCounter;
-            nodeCHMemory.push_back(scheduleEntry);
-            TDMADelayCounter++;
-        }
+    // Members get back-to-back slots in join order, the CH uplink follows the last one
+    TDMADelayCounter = 0;
+    for (auto& scheduleEntry : nodeCHMemory) {
+        scheduleEntry.TDMAdelay = TDMADelayCounter;
+        TDMADelayCounter += slotDuration.dbl();
     }
+    slotOffset = TDMADelayCounter;
+    // The uplink aggregates one reading per member plus the CH's own
+    frameDuration = slotOffset + getChunkAirtime(getAggregateChunkLength(nodeCHMemory.size() + 1));
 
-    EV << "Generated TDMA schedule with " << nodeCHMemory.size() << " slots" << endl;
+    EV << "Generated TDMA schedule with " << nodeCHMemory.size() << " slots of " << slotDuration
+       << ", frame duration " << frameDuration << endl;
 }
 
 void Leach::setLeachState(LeachState ls) {
@@ -349,6 +705,7 @@ void Leach::setLeachState(LeachState ls) {
        << (leachState == ch ? "CH" : "NCH") << " -> " << (ls == ch ? "CH" : "NCH")
        << " at " << simTime() << endl;
     leachState = ls;
+    emit(leachStateChangedSignal, (intval_t)ls);
     refreshDisplay();
 }
 
@@ -360,21 +717,132 @@ void Leach::sendAckToCH(Ipv4Address nodeAddr, Ipv4Address CHAddr) {
 
     auto ackPacket = new Packet("LeachAckPkt", ackPkt);
     auto addressReq = ackPacket->addTag<L3AddressReq>();
-    addressReq->setDestAddress(getIdealCH(nodeAddr));
+    addressReq->setDestAddress(CHAddr);
     addressReq->setSrcAddress(nodeAddr);
     ackPacket->addTag<InterfaceReq>()->setInterfaceId(interface80211ptr->getInterfaceId());
     ackPacket->addTag<PacketProtocolTag>()->setProtocol(&Protocol::manet);
     ackPacket->addTag<DispatchProtocolReq>()->setProtocol(&Protocol::ipv4);
 
     send(ackPacket, "ipOut");
-    addToEventLog(nodeAddr, getIdealCH(nodeAddr), "ACK", "SENT");
+    addToEventLog(nodeAddr, CHAddr, TRACE_ACK, TRACE_SENT);
+}
+
+void Leach::joinIdealCH() {
+    Ipv4Address selfAddr = interface80211ptr->getProtocolData<Ipv4InterfaceData>()->getIPAddress();
+    idealCH = getIdealCH(selfAddr);
+    if (idealCH.isLimitedBroadcastAddress()) {
+        idealCH = Ipv4Address::UNSPECIFIED_ADDRESS;
+        return;
+    }
+
+    EV << "Node " << host->getFullName() << " joins CH " << idealCH << " out of " << nodeMemory.size() << " advertised" << endl;
+    sendAckToCH(selfAddr, idealCH);
+    // The table is rebuilt from the advertisements of the next round
+    nodeMemory.clear();
+}
+
+void Leach::sendStatusToBS(Ipv4Address selfAddr) {
+    const SinkEntry *sink = selectSink();
+    if (sink == nullptr) {
+        EV_WARN << "Node " << host->getFullName() << " knows no sink to report its status to" << endl;
+        return;
+    }
+
+    auto statusPkt = makeShared<LeachStatusPkt>();
+    statusPkt->setPacketType(STATUS);
+    statusPkt->setChunkLength(b(128 + 96));
+    statusPkt->setSrcAddress(selfAddr);
+    statusPkt->setPosition(getPosition());
+    statusPkt->setResidualEnergy(getResidualEnergy());
+
+    auto statusPacket = new Packet("LeachStatusPkt", statusPkt);
+    auto addressReq = statusPacket->addTag<L3AddressReq>();
+    addressReq->setDestAddress(sink->address);
+    addressReq->setSrcAddress(selfAddr);
+    statusPacket->addTag<InterfaceReq>()->setInterfaceId(interface80211ptr->getInterfaceId());
+    statusPacket->addTag<PacketProtocolTag>()->setProtocol(&Protocol::manet);
+    statusPacket->addTag<DispatchProtocolReq>()->setProtocol(&Protocol::ipv4);
+
+    addToEventLog(selfAddr, sink->address, TRACE_STATUS, TRACE_SENT);
+    send(statusPacket, "ipOut");
+}
+
+void Leach::processAssignment(const Ptr<LeachAssignPkt>& assignPkt, Ipv4Address selfAddr) {
+    Ipv4Address assignedCH;
+    for (size_t i = 0; i < assignPkt->getAssignmentArraySize(); i++) {
+        const ClusterAssignment& entry = assignPkt->getAssignment(i);
+        if (entry.getNodeAddress() == selfAddr) {
+            assignedCH = entry.getCHAddress();
+            break;
+        }
+    }
+    if (assignedCH.isUnspecified())
+        return;  // partition of another sink, or the status was lost
+
+    if (assignedCH != selfAddr) {
+        // Members wait for the schedule of their CH, no advertisement or ACK is needed
+        EV << "Node " << host->getFullName() << " assigned to CH " << assignedCH << endl;
+        idealCH = assignedCH;
+        return;
+    }
+
+    EV << "Node " << host->getFullName() << " assigned CH role by " << assignPkt->getSrcAddress() << endl;
+    weight++;
+    if (statistics != nullptr)
+        statistics->clusterHeadElected(energyClass);
+    setLeachState(ch);
+    wasCH = true;
+    nodeCHMemory.clear();
+    nodeCHIndex.clear();
+    for (size_t i = 0; i < assignPkt->getAssignmentArraySize(); i++) {
+        const ClusterAssignment& entry = assignPkt->getAssignment(i);
+        if (entry.getCHAddress() == selfAddr && entry.getNodeAddress() != selfAddr)
+            addToNodeCHMemory(entry.getNodeAddress());
+    }
+    if (statistics != nullptr)
+        statistics->clusterFormed(nodeCHMemory.size());
+    if (multiHop)
+        selectNextHop();
+    startSteadyState(selfAddr);
+}
+
+void Leach::startSteadyState(Ipv4Address selfAddr) {
+    if (!nodeCHMemory.empty()) {
+        sendSchToNCH(selfAddr);
+    } else if (sensingSource != SENSING_NONE) {
+        // A CH without members still uplinks its own readings every frame
+        generateTDMASchedule();
+        startFrames(simTime());
+    } else if (!multiHop) {
+        sleepUntilNextSetup(simTime());
+    }
+}
+
+void Leach::startFrames(simtime_t firstFrameStart) {
+    // Frames repeat until the next setup phase may begin, the CH uplinks after the member slots
+    frameStart = firstFrameStart;
+    simtime_t steadyStateEnd = roundStartTime + roundDuration - par("maxVariance").doubleValue();
+    numFrames = std::max(1, (int)floor((steadyStateEnd - frameStart) / frameDuration));
+    if (maxFramesPerRound > 0)
+        numFrames = std::min(numFrames, maxFramesPerRound);
+    currentFrame = 0;
+    rescheduleAt(frameStart + slotOffset, aggregationTimer);
 }
 
 void Leach::sendSchToNCH(Ipv4Address selfAddr) {
+    generateTDMASchedule();
+
+    // The first frame starts once the schedule itself is on air
+    b scheduleLength = getScheduleChunkLength(nodeCHMemory.size());
+    startFrames(simTime() + getChunkAirtime(scheduleLength));
+
     auto schedulePkt = makeShared<LeachSchedulePkt>();
     schedulePkt->setPacketType(SCH);
-    schedulePkt->setChunkLength(b(128));
+    schedulePkt->setChunkLength(scheduleLength);
     schedulePkt->setSrcAddress(selfAddr);
+    schedulePkt->setFrameStart(frameStart);
+    schedulePkt->setFrameDuration(frameDuration.dbl());
+    schedulePkt->setNumFrames(numFrames);
 
     for (auto& it : nodeCHMemory) {
         ScheduleEntry scheduleEntry;
@@ -392,131 +860,311 @@ void Leach::sendSchToNCH(Ipv4Address selfAddr) {
     schedulePacket->addTag<DispatchProtocolReq>()->setProtocol(&Protocol::ipv4);
 
     send(schedulePacket, "ipOut");
-    addToEventLog(selfAddr, Ipv4Address(255, 255, 255, 255), "SCH", "SENT");
+    addToEventLog(selfAddr, Ipv4Address(255, 255, 255, 255), TRACE_SCH, TRACE_SENT);
+
+    EV << "CH " << host->getFullName() << " schedules " << numFrames << " frames starting at " << frameStart << endl;
 }
 
-void Leach::sendDataToCH(Ipv4Address nodeAddr, Ipv4Address CHAddr, double TDMAslot) {
+void Leach::sendDataToCH(Ipv4Address nodeAddr, Ipv4Address CHAddr, const SensorReading& reading) {
     auto dataPkt = makeShared<LeachDataPkt>();
     dataPkt->setPacketType(DATA);
-    double temperature = uniform(0, 1);
-    double humidity = uniform(0, 1);
-    std::string fingerprint = resolveFingerprint(nodeAddr, getIdealCH(nodeAddr));
+    LeachPacketId packetId = generatePacketId();
 
     dataPkt->setChunkLength(b(128));
-    dataPkt->setTemperature(temperature);
-    dataPkt->setHumidity(humidity);
+    dataPkt->setTemperature(reading.temperature);
+    dataPkt->setHumidity(reading.humidity);
     dataPkt->setSrcAddress(nodeAddr);
-    dataPkt->setFingerprint(fingerprint.c_str());
-    addToPacketLog(fingerprint);
+    dataPkt->setPacketId(packetId);
+    addToPacketLog(packetId);
 
     auto dataPacket = new Packet("LEACHDataPkt", dataPkt);
     auto addressReq = dataPacket->addTag<L3AddressReq>();
-    addressReq->setDestAddress(getIdealCH(nodeAddr));
+    addressReq->setDestAddress(CHAddr);
     addressReq->setSrcAddress(nodeAddr);
     dataPacket->addTag<InterfaceReq>()->setInterfaceId(interface80211ptr->getInterfaceId());
     dataPacket->addTag<PacketProtocolTag>()->setProtocol(&Protocol::manet);
     dataPacket->addTag<DispatchProtocolReq>()->setProtocol(&Protocol::ipv4);
 
-    sendDelayed(dataPacket, TDMAslot, "ipOut");
-    addToEventLog(nodeAddr, getIdealCH(nodeAddr), "DATA", "SENT");
-    dataPktSent++;
+    send(dataPacket, "ipOut");
+    addToEventLog(nodeAddr, CHAddr, TRACE_DATA, TRACE_SENT);
+}
+
+void Leach::addToAggregation(LeachPacketId packetId, double temperature, double humidity) {
+    if (aggregatedPacketIds.empty()) {
+        aggregatedTemperature = temperature;
+        aggregatedHumidity = humidity;
+    } else {
+        switch (aggregationFunction) {
+            case AGGREGATE_MEAN:
+            case AGGREGATE_COUNT:
+                aggregatedTemperature += temperature;
+                aggregatedHumidity += humidity;
+                break;
+            case AGGREGATE_MIN:
+                aggregatedTemperature = std::min(aggregatedTemperature, temperature);
+                aggregatedHumidity = std::min(aggregatedHumidity, humidity);
+                break;
+            case AGGREGATE_MAX:
+                aggregatedTemperature = std::max(aggregatedTemperature, temperature);
+                aggregatedHumidity = std::max(aggregatedHumidity, humidity);
+                break;
+        }
+    }
+    aggregatedPacketIds.push_back(packetId);
 }
 
-void Leach::sendDataToBS(Ipv4Address CHAddr, std::string fingerprint) {
+void Leach::sendDataToBS(Ipv4Address CHAddr) {
+    int readingCount = aggregatedPacketIds.size();
+    if (readingCount == 0)
+        return;
+
     auto bsPkt = makeShared<LeachBSPkt>();
     bsPkt->setPacketType(BS);
-    bsPkt->setChunkLength(b(128));
+    bsPkt->setChunkLength(getAggregateChunkLength(readingCount));
     bsPkt->setCHAddr(CHAddr);
-    bsPkt->setFingerprint(fingerprint.c_str());
+    bsPkt->setReadingCount(readingCount);
+    switch (aggregationFunction) {
+        case AGGREGATE_MEAN:
+            bsPkt->setTemperature(aggregatedTemperature / readingCount);
+            bsPkt->setHumidity(aggregatedHumidity / readingCount);
+            break;
+        case AGGREGATE_MIN:
+        case AGGREGATE_MAX:
+            bsPkt->setTemperature(aggregatedTemperature);
+            bsPkt->setHumidity(aggregatedHumidity);
+            break;
+        case AGGREGATE_COUNT:
+            bsPkt->setTemperature(readingCount);
+            bsPkt->setHumidity(readingCount);
+            break;
+    }
+    bsPkt->setSourcePacketIdsArraySize(readingCount);
+    for (int i = 0; i < readingCount; i++)
+        bsPkt->setSourcePacketIds(i, aggregatedPacketIds[i]);
+    aggregatedPacketIds.clear();
+    bsPkt->setHopCount(1);
+    bsPkt->setOriginTime(simTime());
+    bsPkt->setLastHopTime(simTime());
+
+    sendBSPacket(bsPkt, CHAddr);
+}
+
+void Leach::relayToBS(const Ptr<LeachBSPkt>& bsPkt, Ipv4Address selfAddr) {
+    emit(hopDelaySignal, simTime() - bsPkt->getLastHopTime());
+    bsPkt->setHopCount(bsPkt->getHopCount() + 1);
+    bsPkt->setLastHopTime(simTime());
+    EV << "Node " << host->getFullName() << " relays aggregate of CH " << bsPkt->getCHAddr() << ", hop " << bsPkt->getHopCount() << endl;
+    if (sendBSPacket(bsPkt, selfAddr))
+        emit(bsPktRelayedSignal, (intval_t)1);
+}
+
+bool Leach::sendBSPacket(const Ptr<LeachBSPkt>& bsPkt, Ipv4Address selfAddr) {
+    Ipv4Address destAddr = nextHop;
+    if (destAddr.isUnspecified()) {
+        const SinkEntry *sink = selectSink();
+        if (sink == nullptr) {
+            EV_WARN << "Node " << host->getFullName() << " knows no sink, dropping aggregate of CH " << bsPkt->getCHAddr() << endl;
+            return false;
+        }
+        destAddr = sink->address;
+    }
 
     auto bsPacket = new Packet("LEACHBsPkt", bsPkt);
     auto addressReq = bsPacket->addTag<L3AddressReq>();
-    addressReq->setDestAddress(Ipv4Address(10, 0, 0, 1));
-    addressReq->setSrcAddress(CHAddr);
+    addressReq->setDestAddress(destAddr);
+    addressReq->setSrcAddress(selfAddr);
     bsPacket->addTag<InterfaceReq>()->setInterfaceId(interface80211ptr->getInterfaceId());
     bsPacket->addTag<PacketProtocolTag>()->setProtocol(&Protocol::manet);
     bsPacket->addTag<DispatchProtocolReq>()->setProtocol(&Protocol::ipv4);
 
     send(bsPacket, "ipOut");
-    bsPktSent++;
-    setLeachState(nch);
+    addToEventLog(selfAddr, destAddr, TRACE_BS, TRACE_SENT);
+    return true;
 }
 
-Ipv4Address Leach::getIdealCH(Ipv4Address nodeAddr) {
-    Ipv4Address tempIdealCHAddr;
-    double tempRxPower = -1.0;  // Set to negative to detect if no CH found
+void Leach::addToBackbone(const LeachAdvPkt *advPkt) {
+    double relayedDistance = getPosition().distance(advPkt->getPosition()) + advPkt->getSinkDistance();
+    roundRelayedSinkDistance = std::min(roundRelayedSinkDistance, relayedDistance);
+    relayedSinkDistance = std::min(relayedSinkDistance, relayedDistance);
+    auto inserted = backboneIndex.insert(advPkt->getSrcAddress(), backboneCHs.size());
+    if (!inserted.second) {
+        BackboneEntry& entry = backboneCHs[*inserted.first];
+        entry.position = advPkt->getPosition();
+        entry.sinkAddress = advPkt->getSinkAddress();
+        entry.sinkDistance = advPkt->getSinkDistance();
+        entry.heardAt = simTime();
+        return;
+    }
+    backboneCHs.push_back({ advPkt->getSrcAddress(), advPkt->getPosition(), advPkt->getSinkAddress(), advPkt->getSinkDistance(), simTime() });
+}
+
+double Leach::getSinkDistance(const SinkEntry *& sink) {
+    // A sink heard directly, or the relayed distance if that is shorter or the only one known
+    double distance;
+    sink = findNearestSink(getPosition(), distance);
+    return std::min(distance, relayedSinkDistance);
+}
 
-    for (auto& it : nodeMemory) {
-        if (it.nodeAddr == nodeAddr && it.energy > tempRxPower) {
-            tempRxPower = it.energy;
-            tempIdealCHAddr = it.CHAddr;
+void Leach::selectNextHop() {
+    // First-order radio model: relaying via a CH costs d(self, CH)^2 + d(CH, sink)^2
+    // instead of d(self, sink)^2, d(CH, sink) being the distance the CH advertised.
+    // Only CHs strictly closer to a sink than this node qualify, which keeps the
+    // backbone free of loops even with several sinks. Without a sink of its own,
+    // any CH that knows one is better than dropping the aggregate.
+    nextHop = Ipv4Address::UNSPECIFIED_ADDRESS;
+    Coord self = getPosition();
+    const SinkEntry *sink;
+    double selfDistance = getSinkDistance(sink);
+    double bestCost = INFINITY;
+    if (sink != nullptr) {
+        double directDistance = self.distance(sink->position);
+        bestCost = directDistance * directDistance;
+    }
+    Ipv4Address viaSink;
+    for (auto& entry : backboneCHs) {
+        if (entry.sinkDistance >= selfDistance)
+            continue;
+        double cost = self.sqrdist(entry.position) + entry.sinkDistance * entry.sinkDistance;
+        if (cost < bestCost) {
+            bestCost = cost;
+            nextHop = entry.address;
+            viaSink = entry.sinkAddress;
         }
     }
+    EV << "CH " << host->getFullName() << " next hop towards the BS: "
+       << (nextHop.isUnspecified() ? (sink != nullptr ? "direct" : "none") : nextHop.str() + " (sink " + viaSink.str() + ")")
+       << " out of " << backboneCHs.size() << " CHs" << endl;
+}
 
-    if (tempRxPower < 0) {
-        EV << "Warning: No CH found for node " << nodeAddr.str() << endl;
-        // Return a default or broadcast address
-        return Ipv4Address(255, 255, 255, 255);
+Coord Leach::getPosition() const {
+    return check_and_cast<IMobility *>(host->getSubmodule("mobility"))->getCurrentPosition();
+}
+
+void Leach::addToSinks(Ipv4Address sinkAddr, const Coord& position, double rxPower) {
+    for (auto& sink : sinks) {
+        if (sink.address == sinkAddr) {
+            sink.position = position;
+            sink.rxPower = rxPower;
+            sink.lastHeard = simTime();
+            return;
+        }
     }
+    EV_INFO << "Node " << host->getFullName() << " learned sink " << sinkAddr << " at " << position << endl;
+    sinks.push_back({ sinkAddr, position, rxPower, simTime() });
+}
+
+void Leach::purgeSinks() {
+    // Sinks that stopped beaconing are forgotten
+    if (sinkTimeout > 0) {
+        simtime_t horizon = simTime() - sinkTimeout;
+        sinks.erase(std::remove_if(sinks.begin(), sinks.end(),
+                [&] (const SinkEntry& sink) { return sink.lastHeard < horizon; }), sinks.end());
+    }
+}
 
-    return tempIdealCHAddr;
+const Leach::SinkEntry *Leach::selectSink() {
+    // The backbone always makes progress by distance, only the final hop may prefer the strongest sink
+    if (sinkSelection == SINK_RSSI) {
+        purgeSinks();
+        const SinkEntry *strongest = nullptr;
+        for (auto& sink : sinks) {
+            if (strongest == nullptr || sink.rxPower > strongest->rxPower)
+                strongest = &sink;
+        }
+        if (strongest != nullptr)
+            return strongest;
+    }
+    double distance;
+    return findNearestSink(getPosition(), distance);
 }
 
-std::string Leach::resolveFingerprint(Ipv4Address nodeAddr, Ipv4Address CHAddr) {
-    std::string CHAddrResolved = std::to_string(CHAddr.getInt());
-    std::string nodeAddrResolved = std::to_string(nodeAddr.getInt());
-    std::string simTimeResolved = std::to_string(simTime().dbl());
+const Leach::SinkEntry *Leach::findNearestSink(const Coord& position, double& distance) {
+    purgeSinks();
 
-    std::hash<std::string> hashFn;
-    size_t hashResolved = hashFn(CHAddrResolved + nodeAddrResolved + simTimeResolved);
-    return std::to_string(hashResolved);
+    const SinkEntry *nearest = nullptr;
+    distance = INFINITY;
+    for (auto& sink : sinks) {
+        double sinkDistance = position.distance(sink.position);
+        if (sinkDistance < distance) {
+            distance = sinkDistance;
+            nearest = &sink;
+        }
+    }
+    if (nearest != nullptr || baseStationAddress.isUnspecified())
+        return nearest;
+
+    // No beacon heard yet, the configured base station is located once through the registry
+    if (fallbackSink.address.isUnspecified()) {
+        cModule *bsHost = LeachAddressRegistry::getInstance().findHost(baseStationAddress);
+        if (bsHost == nullptr)
+            throw cRuntimeError("No node has the base station address %s", baseStationAddress.str().c_str());
+        fallbackSink.address = baseStationAddress;
+        fallbackSink.position = check_and_cast<IMobility *>(bsHost->getSubmodule("mobility"))->getCurrentPosition();
+    }
+    distance = position.distance(fallbackSink.position);
+    return &fallbackSink;
 }
 
-bool Leach::checkFingerprint(std::string fingerprint) {
-    for (auto& it : packetLog) {
-        if (it.fingerprint == fingerprint) return true;
+Ipv4Address Leach::getIdealCH(Ipv4Address nodeAddr) {
+    // The strongest advertisement is tracked as CHs are added
+    if (!nodeMemory.hasBestCH()) {
+        EV << "Warning: No CH found for node " << nodeAddr.str() << endl;
+        // Return a default or broadcast address
+        return Ipv4Address(255, 255, 255, 255);
     }
-    return false;
+
+    return nodeMemory.getBestCH();
 }
 
-void Leach::addToPacketLog(std::string fingerprint) {
+LeachPacketId Leach::generatePacketId() {
+    return makeLeachPacketId(host->getIndex(), round, sequencenumber++);
+}
+
+void Leach::addToPacketLog(LeachPacketId packetId) {
     packetLogEntry packet;
-    packet.fingerprint = fingerprint;
+    packet.packetId = packetId;
     packetLog.push_back(packet);
 }
 
-void Leach::addToEventLog(Ipv4Address srcAddr, Ipv4Address destAddr, std::string packet, std::string type) {
-    const char* srcNodeName = L3AddressResolver().findHostWithAddress(srcAddr)->getFullName();
-    const char* destNodeName;
+void Leach::addToEventLog(Ipv4Address srcAddr, Ipv4Address destAddr, LeachTracePacket packet, LeachTraceDirection type) {
+    // Every send and receive passes here, so this also counts the packets per type
+    emit(type == TRACE_SENT ? packetSentSignals[packet] : packetReceivedSignals[packet], (intval_t)1);
+    if (eventTrace == nullptr)
+        return;
+
+    LeachAddressRegistry& addressRegistry = LeachAddressRegistry::getInstance();
+    int srcNode = addressRegistry.findNodeId(srcAddr);
+    if (srcNode < 0) {
+        srcNode = TRACE_NODE_UNKNOWN;
+        EV << "Warning: Could not resolve source name for " << srcAddr.str() << endl;
+    }
+    int destNode;
     if (destAddr.isLimitedBroadcastAddress()) {
-        destNodeName = "Broadcast";
+        destNode = TRACE_NODE_BROADCAST;
     } else {
-        cModule* destModule = L3AddressResolver().findHostWithAddress(destAddr);
-        if (destModule) {
-            destNodeName = destModule->getFullName();
-        } else {
-            destNodeName = "Unknown";
+        destNode = addressRegistry.findNodeId(destAddr);
+        if (destNode < 0) {
+            destNode = TRACE_NODE_UNKNOWN;
             EV << "Warning: Could not resolve destination name for " << destAddr.str() << endl;
         }
     }
 
-    J residualCapacity = J(0);
-    try {
-        SimpleEpEnergyStorage *energyStorageModule = check_and_cast<SimpleEpEnergyStorage*>(host->getSubmodule("energyStorage"));
-        residualCapacity = energyStorageModule->getResidualEnergyCapacity();
-    } catch (const cRuntimeError& e) {
-        EV << "Energy storage error: " << e.what() << endl;
-    }
+    eventTrace->record(simTime(), srcNode, destNode, packet, type, getResidualEnergy(), leachState);
+}
+
+J Leach::getNodeCurrentEnergy() const {
+    return J(getResidualEnergy());
+}
+
+double Leach::getEnergyPercentage() const {
+    if (energyStorage == nullptr)
+        return 0;
+    return 100 * energyStorage->getResidualEnergyCapacity().get() / energyStorage->getNominalEnergyCapacity().get();
+}
 
-    eventLogEntry nodeEvent;
-    nodeEvent.srcNodeName = srcNodeName;
-    nodeEvent.destNodeName = destNodeName;
-    nodeEvent.time = simTime().dbl() * 1000;
-    nodeEvent.packet = packet;
-    nodeEvent.type = type;
-    nodeEvent.residualCapacity = residualCapacity;
-    nodeEvent.state = (leachState == ch ? "ch" : "nch");
-    eventLog.push_back(nodeEvent);
+void Leach::sampleResidualEnergy() {
+    if (energySampleTimer != nullptr)
+        emit(residualEnergySignal, getResidualEnergy());
 }
 
 void Leach::addToNodePosList() {
@@ -537,22 +1185,6 @@ void Leach::addToNodeWeightList() {
     nodeWeightList.push_back(nodeWeight);
 }
 
-void Leach::generateEventLogCSV() {
-    std::ofstream eventLogFile("eventLog.csv");
-    eventLogFile << "Time,Node,Rx-Tx Node,Packet,Type,Energy,State" << std::endl;
-    for (auto& it : eventLog) {
-        std::string resolvedResidualCapacity = it.residualCapacity.str().erase(it.residualCapacity.str().size() - 2, 2);
-        if (it.type == "SENT") {
-            eventLogFile << it.time << "," << it.srcNodeName << "," << it.destNodeName << "," << it.packet << "," << it.type << ","
-                         << resolvedResidualCapacity << "," << it.state << std::endl;
-        } else {
-            eventLogFile << it.time << "," << it.destNodeName << "," << it.srcNodeName << "," << it.packet << "," << it.type << ","
-                         << resolvedResidualCapacity << "," << it.state << std::endl;
-        }
-    }
-    eventLogFile.close();
-}
-
 void Leach::generateNodePosCSV() {
     std::ofstream nodePosFile("nodePos.csv");
     nodePosFile << "Node,X,Y,weight" << std::endl;
@@ -569,12 +1201,24 @@ void Leach::generateNodePosCSV() {
 }
 
 void Leach::generatePacketLogCSV() {
-    std::ofstream packetLogFile("packetLog.csv");
-    packetLogFile << "Data-Sent" << std::endl;
+    if (packetLogFile.empty())
+        return;
+    std::ofstream& file = sharedPacketLogs[packetLogFile].file;
     for (auto& packetLogIterator : packetLog) {
-        packetLogFile << packetLogIterator.fingerprint << std::endl;
+        LeachPacketId packetId = packetLogIterator.packetId;
+        file << packetId << "," << getLeachPacketIdSource(packetId) << "," << getLeachPacketIdRound(packetId) << ","
+             << getLeachPacketIdSequence(packetId) << "\n";
     }
-    packetLogFile.close();
+    releasePacketLog();
+}
+
+void Leach::releasePacketLog() {
+    if (packetLogFile.empty())
+        return;
+    auto it = sharedPacketLogs.find(packetLogFile);
+    if (--it->second.refCount == 0)
+        sharedPacketLogs.erase(it);
+    packetLogFile.clear();
 }
 
 void Leach::refreshDisplay() const {
@@ -594,25 +1238,125 @@ void Leach::refreshDisplay() const {
     host->getDisplayString().setTagArg("i", 0, icon);
 }
 
+void Leach::scheduleNextReading() {
+    switch (sensingSource) {
+        case SENSING_PERIODIC:
+            scheduleAfter(sensingInterval, sensingTimer);
+            break;
+        case SENSING_POISSON:
+            scheduleAfter(exponential(sensingInterval), sensingTimer);
+            break;
+        case SENSING_TRACE:
+            // Rows before the current time (e.g. after a restart) are skipped
+            if (sensingTraceIndex < sensingTraceEnd && sensorTrace->getTime(sensingTraceIndex) < simTime().dbl())
+                sensingTraceIndex = sensorTrace->findFirst(host->getIndex(), simTime().dbl());
+            if (sensingTraceIndex < sensingTraceEnd)
+                scheduleAt(sensorTrace->getTime(sensingTraceIndex), sensingTimer);
+            break;
+        case SENSING_NONE:
+            break;
+    }
+}
+
+void Leach::senseReading() {
+    SensorReading reading;
+    if (sensingSource == SENSING_TRACE) {
+        reading = { sensorTrace->getTime(sensingTraceIndex), sensorTrace->getTemperature(sensingTraceIndex), sensorTrace->getHumidity(sensingTraceIndex) };
+        sensingTraceIndex++;
+    } else {
+        reading = { simTime(), uniform(0, 1), uniform(0, 1) };
+    }
+    readingsSensed++;
+    emit(readingSensedSignal, (intval_t)1);
+
+    if (sensingQueueCapacity > 0 && sensingQueue.size() >= sensingQueueCapacity) {
+        readingsDropped++;
+        emit(readingDroppedSignal, (intval_t)1);
+        return;
+    }
+    sensingQueue.push_back(reading);
+    emit(sensingQueueLengthSignal, (intval_t)sensingQueue.size());
+}
+
+bool Leach::takeReading(SensorReading& reading) {
+    // Without a sensing source every slot carries one fresh reading
+    if (sensingSource == SENSING_NONE) {
+        if (leachState != nch)
+            return false;
+        reading = { simTime(), uniform(0, 1), uniform(0, 1) };
+        return true;
+    }
+    if (sensingQueue.empty())
+        return false;
+    reading = sensingQueue.front();
+    sensingQueue.pop_front();
+    emit(sensingQueueLengthSignal, (intval_t)sensingQueue.size());
+    return true;
+}
+
+void Leach::sleepRadio() {
+    if (!dutyCycling || radio->getRadioMode() == physicallayer::IRadio::RADIO_MODE_SLEEP)
+        return;
+    // Never cut off a frame that the MAC is still transmitting
+    if (radio->getTransmissionState() == physicallayer::IRadio::TRANSMISSION_STATE_TRANSMITTING) {
+        rescheduleAfter(slotGuardTime, sleepTimer);
+        return;
+    }
+    EV_DETAIL << "Node " << host->getFullName() << " radio goes to sleep" << endl;
+    radio->setRadioMode(physicallayer::IRadio::RADIO_MODE_SLEEP);
+}
+
+void Leach::wakeRadio() {
+    if (!dutyCycling || radio->getRadioMode() != physicallayer::IRadio::RADIO_MODE_SLEEP)
+        return;
+    EV_DETAIL << "Node " << host->getFullName() << " radio wakes up" << endl;
+    radio->setRadioMode(physicallayer::IRadio::RADIO_MODE_RECEIVER);
+}
+
+simtime_t Leach::getNextSetupTime() const {
+    // Other nodes start their rounds up to maxVariance earlier than this one
+    return roundStartTime + roundDuration - par("maxVariance").doubleValue();
+}
+
+void Leach::sleepUntilNextSetup(simtime_t activeUntil) {
+    if (!dutyCycling)
+        return;
+    simtime_t wakeTime = getNextSetupTime();
+    if (wakeTime <= activeUntil)
+        return;
+    rescheduleAt(activeUntil, sleepTimer);
+    rescheduleAt(wakeTime, wakeTimer);
+}
+
+void Leach::receiveSignal(cComponent *source, simsignal_t signalID, intval_t value, cObject *details) {
+    if (signalID == physicallayer::IRadio::radioModeChangedSignal) {
+        radioModeTime[lastRadioMode] += simTime() - lastRadioModeChange;
+        lastRadioMode = static_cast<physicallayer::IRadio::RadioMode>(value);
+        lastRadioModeChange = simTime();
+    }
+}
+
 void Leach::finish() {
     addToNodeWeightList();
-    generateEventLogCSV();
+    if (eventTrace != nullptr) {
+        eventTrace->release();
+        eventTrace = nullptr;
+    }
+    if (sensorTrace != nullptr) {
+        sensorTrace->release();
+        sensorTrace = nullptr;
+    }
     generateNodePosCSV();
     generatePacketLogCSV();
 
-    EV << "Total control packets sent by CH: " << controlPktSent << endl;
-    EV << "Total control packets received by NCHs from CH: " << controlPktReceived << endl;
-    EV << "Total data packets sent to CH: " << dataPktSent << endl;
-    EV << "Total data packets received by CH from NCHs: " << dataPktReceived << endl;
-    EV << "Total data packets received by CH from NCHs verified: " << dataPktReceivedVerf << endl;
-    EV << "Total BS packets sent by CH: " << bsPktSent << endl;
-
-    recordScalar("#dataPktSent", dataPktSent);
-    recordScalar("#dataPktReceived", dataPktReceived);
-    recordScalar("#dataPktReceivedVerf", dataPktReceivedVerf);
-    recordScalar("#controlPktSent", controlPktSent);
-    recordScalar("#controlPktReceived", controlPktReceived);
-    recordScalar("#bsPktSent", bsPktSent);
+    if (radio != nullptr) {
+        radioModeTime[lastRadioMode] += simTime() - lastRadioModeChange;
+        lastRadioModeChange = simTime();
+        for (int mode = physicallayer::IRadio::RADIO_MODE_OFF; mode <= physicallayer::IRadio::RADIO_MODE_SWITCHING; mode++) {
+            std::string name = std::string("radioModeTime:") + physicallayer::IRadio::getRadioModeName(static_cast<physicallayer::IRadio::RadioMode>(mode));
+            recordScalar(name.c_str(), radioModeTime[mode], "s");
+        }
+    }
 }
 
 } // namespace inet
@@ -1,6 +1,8 @@
 #ifndef __INET_LEACH_H__
 #define __INET_LEACH_H__
 
+#include <deque>
+
 #include "inet/common/INETDefs.h"
 #include "inet/common/packet/Packet.h"
 #include "inet/networklayer/contract/IInterfaceTable.h"
@@ -9,7 +11,14 @@
 #include "inet/networklayer/contract/IRoutingTable.h"
 #include "inet/routing/base/RoutingProtocolBase.h"
 #include "inet/routing/leach/LeachPkts_m.h"
+#include "inet/routing/leach/LeachNeighborTable.h"
+#include "inet/routing/leach/LeachPacketId.h"
+#include "inet/routing/leach/LeachEventTrace.h"
+#include "inet/routing/leach/LeachSensorTrace.h"
+#include "inet/routing/leach/LeachStatistics.h"
+#include "inet/routing/leach/LeachElectionPolicy.h"
 #include "inet/power/storage/SimpleEpEnergyStorage.h"
+#include "inet/physicallayer/wireless/common/contract/packetlevel/IRadio.h"
 #include "inet/mobility/contract/IMobility.h"
 #include "inet/common/geometry/common/Coord.h"
 
@@ -24,7 +33,7 @@ namespace inet {
  * - Data transmission to CH and from CH to base station
  * - Energy monitoring and state management
  */
-class INET_API Leach : public RoutingProtocolBase {
+class INET_API Leach : public RoutingProtocolBase, public cListener {
   private:
     struct ForwardEntry {
         cMessage *event = nullptr;
@@ -35,27 +44,28 @@ class INET_API Leach : public RoutingProtocolBase {
 
     bool isForwardHello = false;
     cMessage *event = nullptr;
+    cMessage *energySampleTimer = nullptr;
+    cMessage *aggregationTimer = nullptr;
+    cMessage *scheduleTimer = nullptr;  // end of the CH's ACK collection window
+    cMessage *joinTimer = nullptr;  // end of the NCH's advertisement collection window
+    cMessage *dataTimer = nullptr;  // NCH's TDMA slot in the current frame
+    cMessage *sleepTimer = nullptr;  // end of the node's active period within a frame
+    cMessage *wakeTimer = nullptr;  // shortly before the next setup phase
+    cMessage *sensingTimer = nullptr;  // next reading of the sensing source
     cPar *broadcastDelay = nullptr;
     std::list<ForwardEntry *> *forwardList = nullptr;
     NetworkInterface *interface80211ptr = nullptr;
     int interfaceId = -1;
-    unsigned int sequencenumber = 0;
+    unsigned int sequencenumber = 0;  // data packets generated in the current round
     cModule *host = nullptr;
+    power::SimpleEpEnergyStorage *energyStorage = nullptr;  // resolved once, nullptr if the host has none
+    physicallayer::IRadio *radio = nullptr;
     ForwardEntry *forwardEntry = nullptr;
 
-    Ipv4Address idealCH;
-
-    simsignal_t subIntervalTot;
+    Ipv4Address idealCH;  // CH joined in the current round, unspecified if none
 
-    int dataPktSent = 0;
-    int dataPktReceived = 0;
-    int dataPktReceivedVerf = 0;
-    int controlPktSent = 0;
-    int controlPktReceived = 0;
-    int bsPktSent = 0;
     int round = 0;
     int weight = 0;
-    int totalChCount = 0;  // Added to track total CH counts over time
 
   protected:
     simtime_t helloInterval;
@@ -65,36 +75,132 @@ class INET_API Leach : public RoutingProtocolBase {
     simtime_t dataPktSendDelay;
     simtime_t CHPktSendDelay;
     simtime_t roundDuration;
+    simtime_t joinWindow;
+    simtime_t advertisementWindow;
+
+    // TDMA timing, derived from the packet length and the bitrate
+    double bitrate = 0;
+    B slotPacketLength = B(0);
+    simtime_t slotGuardTime;
+    simtime_t slotDuration;
+    int maxFramesPerRound = 0;
+
+    // steady-state phase of the current round, as CH or as member
+    simtime_t frameStart;
+    simtime_t frameDuration;
+    simtime_t slotOffset;  // CH: end of the member slots, NCH: own slot
+    int numFrames = 0;
+    int currentFrame = 0;
+
+    // radio duty cycling and the time spent in each radio mode
+    bool dutyCycling = false;
+    physicallayer::IRadio::RadioMode lastRadioMode = physicallayer::IRadio::RADIO_MODE_OFF;
+    simtime_t lastRadioModeChange;
+    simtime_t radioModeTime[physicallayer::IRadio::RADIO_MODE_SWITCHING + 1];
+
+    simtime_t energySamplingInterval;
+
+    static simsignal_t subIntervalTotSignal;  // round started, the value is the round number
+    static simsignal_t leachStateChangedSignal;
+    static simsignal_t packetSentSignals[TRACE_ASSIGN + 1];  // indexed by LeachTracePacket
+    static simsignal_t packetReceivedSignals[TRACE_ASSIGN + 1];
+    static simsignal_t bsPktRelayedSignal;
+    static simsignal_t readingSensedSignal;
+    static simsignal_t residualEnergySignal;
+    static simsignal_t sensingQueueLengthSignal;
+    static simsignal_t readingDroppedSignal;
+    static simsignal_t hopDelaySignal;
+
+    // Multi-hop backbone: CHs advertised around the current round and the chosen next hop towards the BS
+    struct BackboneEntry {
+        Ipv4Address address;
+        Coord position;
+        Ipv4Address sinkAddress;
+        double sinkDistance;  // advertised by the CH, along the backbone
+        simtime_t heardAt;
+    };
+
+    bool multiHop = false;
+    std::vector<BackboneEntry> backboneCHs;
+    LeachAddressMap<size_t> backboneIndex;  // CH address -> index in backboneCHs
+    Ipv4Address nextHop;  // unspecified if the CH sends directly to the BS
+    // Distance to a sink via advertising CHs, so that CHs out of beacon range still find one.
+    // Advertisements of the previous round are kept, the order of the CHs within a round is random.
+    double relayedSinkDistance = INFINITY;
+    double roundRelayedSinkDistance = INFINITY;  // current round only
+
+    // Sinks learned from LeachBS beacons, the configured base station is only a fallback
+    struct SinkEntry {
+        Ipv4Address address;
+        Coord position;
+        double rxPower;  // of the last beacon
+        simtime_t lastHeard;
+    };
+
+    enum SinkSelection { SINK_DISTANCE, SINK_RSSI };
+    SinkSelection sinkSelection = SINK_DISTANCE;
+    std::vector<SinkEntry> sinks;
+    simtime_t sinkTimeout;
+    Ipv4Address baseStationAddress;  // unspecified if there is no fallback
+    SinkEntry fallbackSink;
 
     int numNodes = 0;
     double clusterHeadPercentage = 0.0;
     double threshold = 0.0;
 
-    double TDMADelayCounter = 1.0;
+    // CH election policy, see LeachElectionPolicy.h
+    enum ElectionPolicy { ELECTION_CLASSIC, ELECTION_ENERGY, ELECTION_QUOTA, ELECTION_SEP };
+    ElectionPolicy electionPolicy = ELECTION_CLASSIC;
+    int electionEpoch = 1;  // rounds after which wasCH is cleared
+    LeachEnergyClass energyClass = LEACH_ENERGY_NORMAL;
+    double advancedFraction = 0;
+    double advancedEnergyFactor = 0;
+    double initialEnergy = 0;  // residual energy at the first start
+    int roundsNotCH = 0;  // consecutive rounds without CH duty
 
-    simtime_t roundStartTime;
+    LeachStatistics *statistics = nullptr;  // network-wide collector, nullptr if there is none
+    bool reportedDown = false;
+
+    double TDMADelayCounter = 0;  // offset of the next free TDMA slot
+
+    // LEACH-C lets the BS pick the CHs and the cluster of every node
+    enum ClusteringMode { CLUSTERING_DISTRIBUTED, CLUSTERING_CENTRALIZED };
+    ClusteringMode clusteringMode = CLUSTERING_DISTRIBUTED;
 
-    struct nodeMemoryObject {
-        Ipv4Address nodeAddr;
-        Ipv4Address CHAddr;
-        double energy;
+    enum AggregationFunction { AGGREGATE_MEAN, AGGREGATE_MIN, AGGREGATE_MAX, AGGREGATE_COUNT };
+    AggregationFunction aggregationFunction = AGGREGATE_MEAN;
+
+    // Sensing workload, readings wait in a drop-tail queue for the next TDMA slot
+    enum SensingSource { SENSING_NONE, SENSING_PERIODIC, SENSING_POISSON, SENSING_TRACE };
+    SensingSource sensingSource = SENSING_NONE;
+
+    struct SensorReading {
+        simtime_t time;
+        double temperature;
+        double humidity;
     };
 
+    simtime_t sensingInterval;
+    size_t sensingQueueCapacity = 0;
+    std::deque<SensorReading> sensingQueue;
+    LeachSensorTrace *sensorTrace = nullptr;  // shared mapping, nullptr unless sensingSource is "trace"
+    uint64_t sensingTraceIndex = 0;  // next row of this node in sensorTrace
+    uint64_t sensingTraceEnd = 0;
+    int readingsSensed = 0;
+    int readingsDropped = 0;
+
+    // member readings fused by the CH during the current TDMA frame
+    std::vector<LeachPacketId> aggregatedPacketIds;
+    double aggregatedTemperature = 0;
+    double aggregatedHumidity = 0;
+
+    simtime_t roundStartTime;
+
     struct TDMAScheduleEntry {
         Ipv4Address nodeAddress;
         double TDMAdelay;
     };
 
-    struct eventLogEntry {
-        std::string srcNodeName;
-        std::string destNodeName;
-        double time;
-        std::string packet;
-        std::string type;
-        J residualCapacity;
-        std::string state;
-    };
-
     struct nodePositionEntry {
         std::string nodeName;
         double posX;
@@ -107,16 +213,18 @@ class INET_API Leach : public RoutingProtocolBase {
     };
 
     struct packetLogEntry {
-        std::string fingerprint;
+        LeachPacketId packetId;
     };
 
-    std::vector<nodeMemoryObject> nodeMemory;
+    LeachNeighborTable nodeMemory;  // CHs heard this round, keyed by CH address
     std::vector<TDMAScheduleEntry> nodeCHMemory;
+    LeachAddressMap<size_t> nodeCHIndex;  // member address -> index in nodeCHMemory
     std::vector<TDMAScheduleEntry> extractedTDMASchedule;
-    std::vector<eventLogEntry> eventLog;
+    LeachEventTrace *eventTrace = nullptr;  // shared binary event log, nullptr if disabled
     std::vector<nodePositionEntry> nodePositionList;
     std::vector<nodeWeightObject> nodeWeightList;
     std::vector<packetLogEntry> packetLog;
+    std::string packetLogFile;  // shared by all nodes, empty if disabled or already written
 
   public:
     Leach();
@@ -142,13 +250,37 @@ class INET_API Leach : public RoutingProtocolBase {
     virtual void refreshDisplay() const override;
     void finish() override;
 
-    enum SelfMsgKinds { SELF = 1, DATA2CH, DATA2BS };
-
-    double generateThresholdValue(int subInterval);
-    void sendDataToCH(Ipv4Address nodeAddr, Ipv4Address CHAddr, double TDMAslot);
-    void sendDataToBS(Ipv4Address CHAddr, std::string fingerprint);
+    enum SelfMsgKinds { SELF = 1, DATA2CH, DATA2BS, ENERGY_SAMPLE, SCHEDULE, JOIN, RADIO_SLEEP, RADIO_WAKE, SENSE };
+
+    LeachElectionContext getElectionContext() const;
+    int getElectionEpoch() const;
+    bool electClusterHead();
+    template<typename Policy> bool electClusterHead(const LeachElectionContext& context);
+    void sendDataToCH(Ipv4Address nodeAddr, Ipv4Address CHAddr, const SensorReading& reading);
+    simtime_t getAirtime(B length) const { return SimTime(length.get() * 8 / bitrate) + slotGuardTime; }
+    // slotPacketLength is the on-air length of a 128 bit data chunk, other chunks carry the same overhead
+    simtime_t getChunkAirtime(b chunkLength) const { return SimTime((slotPacketLength.get() * 8 - 128 + chunkLength.get()) / bitrate) + slotGuardTime; }
+    static b getScheduleChunkLength(int numEntries) { return b(128 + 96 * numEntries); }
+    static b getAggregateChunkLength(int readingCount) { return b(128 + 64 * readingCount); }
+    void sendDataToBS(Ipv4Address CHAddr);
+    bool sendBSPacket(const Ptr<LeachBSPkt>& bsPkt, Ipv4Address selfAddr);
+    void relayToBS(const Ptr<LeachBSPkt>& bsPkt, Ipv4Address selfAddr);
+    void addToBackbone(const LeachAdvPkt *advPkt);
+    void selectNextHop();
+    double getSinkDistance(const SinkEntry *& sink);
+    Coord getPosition() const;
+    void addToSinks(Ipv4Address sinkAddr, const Coord& position, double rxPower);
+    void purgeSinks();
+    const SinkEntry *findNearestSink(const Coord& position, double& distance);
+    const SinkEntry *selectSink();
+    void addToAggregation(LeachPacketId packetId, double temperature, double humidity);
     void sendAckToCH(Ipv4Address nodeAddr, Ipv4Address CHAddr);
+    void joinIdealCH();
+    void startSteadyState(Ipv4Address selfAddr);
+    void startFrames(simtime_t firstFrameStart);
     void sendSchToNCH(Ipv4Address selfAddr);
+    void sendStatusToBS(Ipv4Address selfAddr);
+    void processAssignment(const Ptr<LeachAssignPkt>& assignPkt, Ipv4Address selfAddr);
 
     void addToNodeMemory(Ipv4Address nodeAddr, Ipv4Address CHAddr, double energy);
     void addToNodeCHMemory(Ipv4Address NCHAddr);
@@ -158,21 +290,36 @@ class INET_API Leach : public RoutingProtocolBase {
     virtual void setLeachState(LeachState ls);
 
     Ipv4Address getIdealCH(Ipv4Address nodeAddr);
-    std::string resolveFingerprint(Ipv4Address nodeAddr, Ipv4Address CHAddr);
-    bool checkFingerprint(std::string fingerprint);
+    LeachPacketId generatePacketId();
 
-    void addToPacketLog(std::string fingerprint);
-    void addToEventLog(Ipv4Address srcAddr, Ipv4Address destAddr, std::string packet, std::string type);
+    void addToPacketLog(LeachPacketId packetId);
+    void addToEventLog(Ipv4Address srcAddr, Ipv4Address destAddr, LeachTracePacket packet, LeachTraceDirection type);
     void addToNodePosList();
     void addToNodeWeightList();
 
-    void generateEventLogCSV();
     void generateNodePosCSV();
     void generatePacketLogCSV();
+    void releasePacketLog();
 
     // Helper methods for energy management
     J getNodeCurrentEnergy() const;
     double getEnergyPercentage() const;
+    double getResidualEnergy() const { return energyStorage != nullptr ? energyStorage->getResidualEnergyCapacity().get() : 0; }
+    void sampleResidualEnergy();
+    void reportDown();
+
+    // Sensing workload
+    void scheduleNextReading();
+    void senseReading();
+    bool takeReading(SensorReading& reading);
+
+    // Radio duty cycling, no-ops unless dutyCycling is set
+    void sleepRadio();
+    void wakeRadio();
+    void sleepUntilNextSetup(simtime_t activeUntil);
+    simtime_t getNextSetupTime() const;
+
+    virtual void receiveSignal(cComponent *source, simsignal_t signalID, intval_t value, cObject *details) override;
 };
 
 } // namespace inet
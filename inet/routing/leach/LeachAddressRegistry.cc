@@ -0,0 +1,75 @@
+#include "inet/routing/leach/LeachAddressRegistry.h"
+
+#include "inet/networklayer/common/L3AddressResolver.h"
+#include "inet/networklayer/contract/IInterfaceTable.h"
+#include "inet/networklayer/ipv4/Ipv4InterfaceData.h"
+
+namespace inet {
+
+LeachAddressRegistry& LeachAddressRegistry::getInstance() {
+    static LeachAddressRegistry instance;
+    return instance;
+}
+
+void LeachAddressRegistry::collectHosts(cModule *parent) {
+    L3AddressResolver resolver;
+    for (cModule::SubmoduleIterator it(parent); !it.end(); ++it) {
+        cModule *module = *it;
+        IInterfaceTable *ift = resolver.findInterfaceTableOf(module);
+        if (ift == nullptr) {
+            // not a network node, but it may contain some
+            collectHosts(module);
+            continue;
+        }
+
+        int nodeId = nodes.size();
+        Node node;
+        node.host = module;
+        node.name = module->getFullName();
+        nodes.push_back(node);
+
+        for (int i = 0; i < ift->getNumInterfaces(); i++) {
+            auto ipv4Data = ift->getInterface(i)->findProtocolData<Ipv4InterfaceData>();
+            if (ipv4Data != nullptr && !ipv4Data->getIPAddress().isUnspecified())
+                addressToNodeId[ipv4Data->getIPAddress().getInt()] = nodeId;
+        }
+    }
+}
+
+void LeachAddressRegistry::build() {
+    nodes.clear();
+    addressToNodeId.clear();
+    collectHosts(getSimulation()->getSystemModule());
+    valid = true;
+}
+
+int LeachAddressRegistry::findNodeId(const Ipv4Address& addr) {
+    if (!valid)
+        build();
+    auto it = addressToNodeId.find(addr.getInt());
+    return it != addressToNodeId.end() ? it->second : -1;
+}
+
+const char *LeachAddressRegistry::findNodeName(const Ipv4Address& addr) {
+    int nodeId = findNodeId(addr);
+    return nodeId >= 0 ? nodes[nodeId].name.c_str() : nullptr;
+}
+
+cModule *LeachAddressRegistry::findHost(const Ipv4Address& addr) {
+    int nodeId = findNodeId(addr);
+    return nodeId >= 0 ? nodes[nodeId].host : nullptr;
+}
+
+int LeachAddressRegistry::getNumNodes() {
+    if (!valid)
+        build();
+    return nodes.size();
+}
+
+const LeachAddressRegistry::Node& LeachAddressRegistry::getNode(int nodeId) {
+    if (!valid)
+        build();
+    return nodes.at(nodeId);
+}
+
+} // namespace inet
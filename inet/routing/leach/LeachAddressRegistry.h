@@ -0,0 +1,58 @@
+#ifndef __INET_LEACHADDRESSREGISTRY_H__
+#define __INET_LEACHADDRESSREGISTRY_H__
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "inet/common/INETDefs.h"
+#include "inet/networklayer/contract/ipv4/Ipv4Address.h"
+
+namespace inet {
+
+/**
+ * @brief Network-wide IPv4 address to node table shared by Leach and LeachBS.
+ *
+ * Resolving an address with L3AddressResolver walks the whole module tree;
+ * this registry does that walk once, lazily on the first lookup, and then
+ * answers from a hash table. Every node gets a dense id in module order,
+ * which is stable as long as the set of nodes does not change.
+ *
+ * Protocol instances invalidate the registry on initialization, the next
+ * lookup rebuilds it. Nodes keep their addresses when they go down and come
+ * back, so lifecycle operations leave the table as it is.
+ */
+class INET_API LeachAddressRegistry {
+  public:
+    struct Node {
+        cModule *host = nullptr;
+        std::string name;
+    };
+
+  private:
+    bool valid = false;
+    std::vector<Node> nodes;
+    std::unordered_map<uint32_t, int> addressToNodeId;
+
+    LeachAddressRegistry() {}
+    void build();
+    void collectHosts(cModule *parent);
+
+  public:
+    static LeachAddressRegistry& getInstance();
+
+    void invalidate() { valid = false; }
+
+    /** Returns the id of the node owning addr, or -1 if no node has that address. */
+    int findNodeId(const Ipv4Address& addr);
+    /** Returns the full name of the node owning addr, or nullptr if unknown. */
+    const char *findNodeName(const Ipv4Address& addr);
+    cModule *findHost(const Ipv4Address& addr);
+
+    int getNumNodes();
+    const Node& getNode(int nodeId);
+};
+
+} // namespace inet
+
+#endif // __INET_LEACHADDRESSREGISTRY_H__
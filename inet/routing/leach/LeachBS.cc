@@ -5,8 +5,10 @@
 #include "inet/linklayer/common/InterfaceTag_m.h"
 #include "inet/networklayer/common/L3AddressTag_m.h"
 #include "inet/routing/leach/Leach.h"
+#include "inet/routing/leach/LeachAddressRegistry.h"
 #include "inet/physicallayer/wireless/common/contract/packetlevel/SignalTag_m.h"
 #include "inet/networklayer/ipv4/Ipv4InterfaceData.h"
+#include "inet/mobility/contract/IMobility.h"
 
 #include <iostream>
 #include <fstream>
@@ -19,9 +21,18 @@ namespace inet {
 
 Define_Module(LeachBS);
 
+simsignal_t LeachBS::hopCountSignal = registerSignal("hopCount");
+simsignal_t LeachBS::endToEndDelaySignal = registerSignal("endToEndDelay");
+simsignal_t LeachBS::hopDelaySignal = registerSignal("hopDelay");
+simsignal_t LeachBS::readingsReceivedSignal = registerSignal("readingsReceived");
+
 LeachBS::LeachBS() {}
 
-LeachBS::~LeachBS() {}
+LeachBS::~LeachBS() {
+    cancelAndDelete(epochTimer);
+    cancelAndDelete(beaconTimer);
+    cancelAndDelete(statusTimer);
+}
 
 void LeachBS::initialize(int stage) {
     RoutingProtocolBase::initialize(stage);
@@ -29,8 +40,27 @@ void LeachBS::initialize(int stage) {
     if (stage == INITSTAGE_LOCAL) {
         sequencenumber = 0;
         host = getContainingNode(this);
+        LeachAddressRegistry::getInstance().invalidate();
         ift = getModuleFromPar<IInterfaceTable>(par("interfaceTableModule"), this);
+        statistics = findModuleFromPar<LeachStatistics>(par("statisticsModule"), this);
         bsPktReceived = 0;
+        readingsReceived = 0;
+        readingsDuplicate = 0;
+        roundDuration = par("roundDuration");
+        receivedFingerprints.setRetention(par("fingerprintRetentionRounds"));
+        if (receivedFingerprints.getRetention() > 0)
+            epochTimer = new cMessage("fingerprintEpoch");
+        beaconInterval = par("beaconInterval");
+        if (beaconInterval > 0)
+            beaconTimer = new cMessage("beacon");
+        statusWindow = par("statusWindow");
+        clusterHeadPercentage = par("clusterHeadPercentage");
+        energyFloor = par("energyFloor");
+        maxIterations = par("maxIterations");
+        numRestarts = par("numRestarts");
+        optimizerThreads = par("optimizerThreads");
+        statusTimer = new cMessage("status");
+        centralizedRounds = 0;
 
         // Initialize the vector for real-time statistics visualization
         packetsPerCHVector.setName("Packets per CH");
@@ -68,14 +98,36 @@ void LeachBS::start() {
     }
 
     interface80211ptr->getProtocolDataForUpdate<Ipv4InterfaceData>()->joinMulticastGroup(Ipv4Address::LL_MANET_ROUTERS);
+
+    if (epochTimer != nullptr)
+        scheduleAt(simTime() + roundDuration, epochTimer);
+    if (beaconTimer != nullptr)
+        scheduleAt(simTime(), beaconTimer);
 }
 
-void LeachBS::stop() {}
+void LeachBS::stop() {
+    if (epochTimer != nullptr)
+        cancelEvent(epochTimer);
+    if (beaconTimer != nullptr)
+        cancelEvent(beaconTimer);
+    if (statusTimer != nullptr)
+        cancelEvent(statusTimer);
+    nodeStatuses.clear();
+    nodeStatusIndex.clear();
+}
 
 void LeachBS::handleMessageWhenUp(cMessage *msg) {
     Ipv4Address nodeAddr = interface80211ptr->getProtocolData<Ipv4InterfaceData>()->getIPAddress();
 
-    if (msg->isSelfMessage()) {
+    if (msg == epochTimer) {
+        receivedFingerprints.advanceEpoch();
+        scheduleAt(simTime() + roundDuration, epochTimer);
+    } else if (msg == beaconTimer) {
+        sendBeacon();
+        scheduleAt(simTime() + beaconInterval, beaconTimer);
+    } else if (msg == statusTimer) {
+        sendAssignment();
+    } else if (msg->isSelfMessage()) {
         delete msg;
     } else if (check_and_cast<Packet *>(msg)->getTag<PacketProtocolTag>()->getProtocol() == &Protocol::manet) {
         auto receivedCtrlPkt = staticPtrCast<LeachControlPkt>(check_and_cast<Packet *>(msg)->peekData<LeachControlPkt>()->dupShared());
@@ -84,27 +136,52 @@ void LeachBS::handleMessageWhenUp(cMessage *msg) {
         auto packetType = leachControlPkt->getPacketType();
 
         if (msg->arrivedOn("ipIn")) {
-            if (packetType == CH || packetType == ACK || packetType == SCH || packetType == DATA) {
+            if (packetType == CH || packetType == ACK || packetType == SCH || packetType == DATA || packetType == BEACON || packetType == ASSIGN) {
+                delete msg;
+            } else if (packetType == STATUS) {
+                auto statusPkt = dynamicPtrCast<LeachStatusPkt>(receivedCtrlPkt);
+                addToNodeStatuses(statusPkt->getSrcAddress(), statusPkt->getPosition(), statusPkt->getResidualEnergy());
+                // Node rounds are up to maxVariance apart, the window collects all of them
+                if (!statusTimer->isScheduled())
+                    scheduleAfter(statusWindow, statusTimer);
                 delete msg;
             } else if (packetType == BS) {
                 bsPktReceived++;
-                std::string fingerprint = receivedCtrlPkt->getFingerprint();
-
-                // Get the source address from the packet
-                auto addressTag = receivedPkt->findTag<L3AddressInd>();
-                if (addressTag) {
-                    Ipv4Address sourceAddr = addressTag->getSrcAddress().toIpv4();
-                    packetsPerCH[sourceAddr]++; // Increment counter for this CH
-
-                    // Display statistics during simulation
-                    EV << "Received packet from CH " << sourceAddr << ", total from this CH: "
-                       << packetsPerCH[sourceAddr] << endl;
-
-                    // Record for real-time visualization
-                    packetsPerCHVector.record(packetsPerCH[sourceAddr]);
+                auto bsPkt = dynamicPtrCast<LeachBSPkt>(receivedCtrlPkt);
+
+                // Relayed aggregates are counted for the CH that created them
+                Ipv4Address sourceAddr = bsPkt->getCHAddr();
+                packetsPerCH[sourceAddr]++; // Increment counter for this CH
+
+                // Display statistics during simulation
+                const char *sourceName = LeachAddressRegistry::getInstance().findNodeName(sourceAddr);
+                EV << "Received packet from CH " << (sourceName ? sourceName : "Unknown") << " (" << sourceAddr
+                   << ") over " << bsPkt->getHopCount() << " hops, total from this CH: " << packetsPerCH[sourceAddr] << endl;
+
+                // Record for real-time visualization
+                packetsPerCHVector.record(packetsPerCH[sourceAddr]);
+
+                emit(hopCountSignal, bsPkt->getHopCount());
+                emit(endToEndDelaySignal, simTime() - bsPkt->getOriginTime());
+                emit(hopDelaySignal, simTime() - bsPkt->getLastHopTime());
+                emit(readingsReceivedSignal, bsPkt->getReadingCount());
+                if (statistics != nullptr)
+                    statistics->aggregateReceived();
+
+                EV << "Aggregate of " << bsPkt->getReadingCount() << " readings: temperature " << bsPkt->getTemperature()
+                   << ", humidity " << bsPkt->getHumidity() << endl;
+
+                // Every fused reading is verified individually
+                for (size_t i = 0; i < bsPkt->getSourcePacketIdsArraySize(); i++) {
+                    LeachPacketId packetId = bsPkt->getSourcePacketIds(i);
+                    readingsReceived++;
+                    if (receivedFingerprints.insert(packetId)) {
+                        addToPacketRecLog(packetId);
+                    } else {
+                        readingsDuplicate++;
+                        EV << "Duplicate reading " << packetId << " dropped at BS" << endl;
+                    }
                 }
-
-                addToPacketRecLog(fingerprint);
                 delete msg;
             }
         } else {
@@ -115,30 +192,127 @@ void LeachBS::handleMessageWhenUp(cMessage *msg) {
     }
 }
 
+void LeachBS::sendBeacon() {
+    // Nodes learn the sink address and position from this broadcast
+    auto beaconPkt = makeShared<LeachBeaconPkt>();
+    beaconPkt->setPacketType(BEACON);
+    beaconPkt->setChunkLength(b(128 + 64));
+    beaconPkt->setPosition(check_and_cast<IMobility *>(host->getSubmodule("mobility"))->getCurrentPosition());
+    sendBroadcast(beaconPkt, "LEACHBeaconPkt");
+}
+
+void LeachBS::sendBroadcast(const Ptr<LeachControlPkt>& ctrlPkt, const char *name) {
+    Ipv4Address selfAddr = interface80211ptr->getProtocolData<Ipv4InterfaceData>()->getIPAddress();
+    ctrlPkt->setSrcAddress(selfAddr);
+
+    auto packet = new Packet(name, ctrlPkt);
+    auto addressReq = packet->addTag<L3AddressReq>();
+    addressReq->setDestAddress(Ipv4Address(255, 255, 255, 255));
+    addressReq->setSrcAddress(selfAddr);
+    packet->addTag<InterfaceReq>()->setInterfaceId(interface80211ptr->getInterfaceId());
+    packet->addTag<PacketProtocolTag>()->setProtocol(&Protocol::manet);
+    packet->addTag<DispatchProtocolReq>()->setProtocol(&Protocol::ipv4);
+
+    send(packet, "ipOut");
+}
+
+void LeachBS::addToNodeStatuses(const Ipv4Address& nodeAddr, const Coord& position, double residualEnergy) {
+    auto inserted = nodeStatusIndex.insert(nodeAddr, nodeStatuses.size());
+    if (!inserted.second) {
+        NodeStatus& status = nodeStatuses[*inserted.first];
+        status.position = position;
+        status.residualEnergy = residualEnergy;
+        return;
+    }
+    nodeStatuses.push_back({ nodeAddr, position, residualEnergy });
+}
+
+void LeachBS::computeClusters(std::vector<int>& clusterHeads, std::vector<int>& assignment) {
+    clusterOptimizer.clear();
+    clusterOptimizer.reserve(nodeStatuses.size());
+    for (auto& status : nodeStatuses)
+        clusterOptimizer.addNode(status.position.x, status.position.y, status.residualEnergy);
+
+    LeachClusterOptimizer::Parameters parameters;
+    parameters.numClusters = std::max(1, (int)std::lround(clusterHeadPercentage * nodeStatuses.size()));
+    parameters.energyFloor = energyFloor;
+    parameters.maxIterations = maxIterations;
+    parameters.numRestarts = numRestarts;
+    parameters.numThreads = optimizerThreads;
+    // Seeded from the module RNG so that runs stay reproducible
+    parameters.seed = ((uint64_t)getRNG(0)->intRand() << 32) | getRNG(0)->intRand();
+
+    auto result = clusterOptimizer.optimize(parameters);
+    EV_DETAIL << "Cluster optimizer: cost " << result.cost << " after " << result.iterations << " iterations of restart " << result.restart << endl;
+    clusterHeads = std::move(result.clusterHeads);
+    assignment = std::move(result.assignment);
+}
+
+void LeachBS::sendAssignment() {
+    std::vector<int> clusterHeads;
+    std::vector<int> assignment;
+    computeClusters(clusterHeads, assignment);
+    centralizedRounds++;
+
+    // One broadcast per cluster, a single one would grow by 64 bits per node of the network
+    std::vector<std::vector<int>> members(clusterHeads.size());
+    for (size_t i = 0; i < nodeStatuses.size(); i++)
+        members[assignment[i]].push_back(i);
+    EV << "Centralized clustering of " << nodeStatuses.size() << " nodes into " << clusterHeads.size() << " clusters" << endl;
+    for (size_t c = 0; c < clusterHeads.size(); c++) {
+        if (members[c].empty())
+            continue;
+        auto assignPkt = makeShared<LeachAssignPkt>();
+        assignPkt->setPacketType(ASSIGN);
+        assignPkt->setChunkLength(b(128 + 64 * members[c].size()));
+        assignPkt->setAssignmentArraySize(members[c].size());
+        for (size_t j = 0; j < members[c].size(); j++) {
+            ClusterAssignment entry;
+            entry.setNodeAddress(nodeStatuses[members[c][j]].address);
+            entry.setCHAddress(nodeStatuses[clusterHeads[c]].address);
+            assignPkt->setAssignment(j, entry);
+        }
+        sendBroadcast(assignPkt, "LeachAssignPkt");
+    }
+    nodeStatuses.clear();
+    nodeStatusIndex.clear();
+}
+
 void LeachBS::generatePacketRecLogCSV() {
-    std::ofstream packetRecLogFile("packetRecLog.csv");
-    packetRecLogFile << "Data-Rec" << std::endl;
+    std::ofstream packetRecLogFile(getOutputFileName("packetRecLog"));
+    packetRecLogFile << "PacketId,Source,Round,Sequence" << std::endl;
     for (auto& packetRecLogIterator : packetRecLog) {
-        packetRecLogFile << packetRecLogIterator.fingerprint << std::endl;
+        LeachPacketId packetId = packetRecLogIterator.packetId;
+        packetRecLogFile << packetId << "," << getLeachPacketIdSource(packetId) << "," << getLeachPacketIdRound(packetId) << ","
+                         << getLeachPacketIdSequence(packetId) << std::endl;
     }
     packetRecLogFile.close();
 }
 
 void LeachBS::generateCHStatsCSV() {
     // Open statistics file
-    std::ofstream chStatsFile("ch_statistics.csv");
-    chStatsFile << "ClusterHead,PacketsReceived" << std::endl;
+    std::ofstream chStatsFile(getOutputFileName("ch_statistics"));
+    chStatsFile << "ClusterHead,PacketsReceived,Node" << std::endl;
 
+    LeachAddressRegistry& addressRegistry = LeachAddressRegistry::getInstance();
     for (auto& entry : packetsPerCH) {
-        chStatsFile << entry.first << "," << entry.second << std::endl;
+        const char *nodeName = addressRegistry.findNodeName(entry.first);
+        chStatsFile << entry.first << "," << entry.second << "," << (nodeName ? nodeName : "Unknown") << std::endl;
     }
 
     chStatsFile.close();
 }
 
-void LeachBS::addToPacketRecLog(std::string fingerprint) {
+std::string LeachBS::getOutputFileName(const char *baseName) const {
+    // With several sinks every one writes its own files
+    if (host->isVector() && host->getVectorSize() > 1)
+        return std::string(baseName) + "_" + std::to_string(host->getIndex()) + ".csv";
+    return std::string(baseName) + ".csv";
+}
+
+void LeachBS::addToPacketRecLog(LeachPacketId packetId) {
     packetRecLogEntry packet;
-    packet.fingerprint = fingerprint;
+    packet.packetId = packetId;
     packetRecLog.push_back(packet);
 }
 
@@ -148,6 +322,7 @@ void LeachBS::finish() {
 
     // Display per-CH statistics
     EV << "Total data packets received by BS from CHs: " << bsPktReceived << endl;
+    EV << "Total readings received by BS: " << readingsReceived << " (" << readingsDuplicate << " duplicates)" << endl;
     EV << "Per-CH statistics:" << endl;
 
     for (auto& entry : packetsPerCH) {
@@ -159,6 +334,12 @@ void LeachBS::finish() {
     }
 
     recordScalar("#bsPktReceived", bsPktReceived);
+    recordScalar("#readingsReceived", readingsReceived);
+    recordScalar("#readingsUnique", readingsReceived - readingsDuplicate);
+    recordScalar("#readingsDuplicate", readingsDuplicate);
+    recordScalar("#chsServed", packetsPerCH.size());
+    if (centralizedRounds > 0)
+        recordScalar("#centralizedRounds", centralizedRounds);
 }
 
 } // namespace inet
@@ -8,6 +8,12 @@
 #include "inet/networklayer/contract/ipv4/Ipv4Address.h"
 #include "inet/routing/base/RoutingProtocolBase.h"
 #include "inet/routing/leach/LeachPkts_m.h"
+#include "inet/routing/leach/LeachFingerprintSet.h"
+#include "inet/routing/leach/LeachNeighborTable.h"
+#include "inet/routing/leach/LeachPacketId.h"
+#include "inet/routing/leach/LeachClusterOptimizer.h"
+#include "inet/routing/leach/LeachStatistics.h"
+#include "inet/common/geometry/common/Coord.h"
 #include <map>
 
 namespace inet {
@@ -15,21 +21,54 @@ namespace inet {
 class INET_API LeachBS : public RoutingProtocolBase {
   private:
     int bsPktReceived = 0;
+    int readingsReceived = 0;
+    int readingsDuplicate = 0;
     NetworkInterface *interface80211ptr = nullptr;
     int interfaceId = -1;
     unsigned int sequencenumber = 0;
     cModule *host = nullptr;
     std::map<Ipv4Address, int> packetsPerCH;  // Map to track packets from each CH
     cOutVector packetsPerCHVector;  // For real-time visualization
+    cMessage *epochTimer = nullptr;
+    cMessage *beaconTimer = nullptr;
+    simtime_t beaconInterval;
+
+    // LEACH-C: statuses reported in the current round, partitioned when statusTimer fires
+    struct NodeStatus {
+        Ipv4Address address;
+        Coord position;
+        double residualEnergy;
+    };
+
+    std::vector<NodeStatus> nodeStatuses;
+    LeachAddressMap<size_t> nodeStatusIndex;  // node address -> index in nodeStatuses
+    cMessage *statusTimer = nullptr;
+    simtime_t statusWindow;
+    double clusterHeadPercentage = 0;
+    double energyFloor = 0;
+    int maxIterations = 0;
+    int numRestarts = 0;
+    int optimizerThreads = 0;
+    LeachClusterOptimizer clusterOptimizer;
+    int centralizedRounds = 0;
+    LeachFingerprintSet receivedFingerprints;
+    LeachStatistics *statistics = nullptr;  // network-wide collector, nullptr if there is none
+
+    static simsignal_t hopCountSignal;
+    static simsignal_t endToEndDelaySignal;
+    static simsignal_t hopDelaySignal;
+    static simsignal_t readingsReceivedSignal;
 
   protected:
     IInterfaceTable *ift = nullptr;
 
     struct packetRecLogEntry {
-        std::string fingerprint;
+        LeachPacketId packetId;
     };
     std::vector<packetRecLogEntry> packetRecLog;
 
+    simtime_t roundDuration;
+
   public:
     LeachBS();
     virtual ~LeachBS();
@@ -46,15 +85,18 @@ class INET_API LeachBS : public RoutingProtocolBase {
     void stop();
     void finish() override;
 
-    void addToPacketRecLog(std::string fingerprint);
-    void generatePacketRecLogCSV();
-    void generateCHStatsCSV();  // New method to generate CH statistics
+    void sendBeacon();
+    void sendBroadcast(const Ptr<LeachControlPkt>& ctrlPkt, const char *name);
 
-    // Added real-time logging method
-    void logPacketReception(int packetNumber, const Ipv4Address& sourceAddr, const std::string& fingerprint);
+    // LEACH-C
+    void addToNodeStatuses(const Ipv4Address& nodeAddr, const Coord& position, double residualEnergy);
+    void computeClusters(std::vector<int>& clusterHeads, std::vector<int>& assignment);
+    void sendAssignment();
 
-    // Modified to include source address
-    void addToPacketRecLog(std::string fingerprint, const Ipv4Address& sourceAddr);
+    void addToPacketRecLog(LeachPacketId packetId);
+    void generatePacketRecLogCSV();
+    void generateCHStatsCSV();  // New method to generate CH statistics
+    std::string getOutputFileName(const char *baseName) const;
 };
 
 } // namespace inet
@@ -0,0 +1,257 @@
+#include "inet/routing/leach/LeachClusterOptimizer.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <thread>
+
+namespace inet {
+
+struct LeachClusterOptimizer::Workspace {
+    std::vector<double> bestDistances;  // per node, squared distance to its CH
+    std::vector<double> centroidXs;
+    std::vector<double> centroidYs;
+    std::vector<int> clusterSizes;
+    std::vector<double> candidateDistances;
+    std::vector<char> used;
+};
+
+static uint64_t splitmix64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Squared distances of n points to (x, y); branch-free so that it vectorizes
+static void computeDistances(const double *__restrict xs, const double *__restrict ys, size_t n, double x, double y, double *__restrict distances) {
+    for (size_t i = 0; i < n; i++) {
+        double dx = xs[i] - x;
+        double dy = ys[i] - y;
+        distances[i] = dx * dx + dy * dy;
+    }
+}
+
+void LeachClusterOptimizer::clear() {
+    xs.clear();
+    ys.clear();
+    energies.clear();
+}
+
+void LeachClusterOptimizer::reserve(size_t numNodes) {
+    xs.reserve(numNodes);
+    ys.reserve(numNodes);
+    energies.reserve(numNodes);
+}
+
+void LeachClusterOptimizer::addNode(double x, double y, double energy) {
+    xs.push_back(x);
+    ys.push_back(y);
+    energies.push_back(energy);
+}
+
+std::vector<int> LeachClusterOptimizer::getCandidates(double energyFloor) const {
+    std::vector<int> candidates;
+    size_t numNodes = xs.size();
+    if (numNodes == 0)
+        return candidates;
+    double meanEnergy = 0;
+    for (double energy : energies)
+        meanEnergy += energy;
+    meanEnergy /= numNodes;
+    for (size_t i = 0; i < numNodes; i++)
+        if (energies[i] >= energyFloor * meanEnergy)
+            candidates.push_back(i);
+    // A floor above the maximum must not leave the network without CHs
+    if (candidates.empty())
+        for (size_t i = 0; i < numNodes; i++)
+            candidates.push_back(i);
+    return candidates;
+}
+
+void LeachClusterOptimizer::seedClusterHeads(Workspace& workspace, const std::vector<int>& candidates, int numClusters, uint64_t seed) const {
+    // k-means++ over the candidates: each further CH is drawn with probability
+    // proportional to the squared distance to the closest CH drawn so far
+    std::mt19937_64 rng(seed);
+    size_t numCandidates = candidates.size();
+    std::vector<double> candidateXs(numCandidates), candidateYs(numCandidates);
+    for (size_t j = 0; j < numCandidates; j++) {
+        candidateXs[j] = xs[candidates[j]];
+        candidateYs[j] = ys[candidates[j]];
+    }
+    std::vector<double>& closest = workspace.candidateDistances;
+    std::vector<double>& distances = workspace.bestDistances;
+    closest.assign(numCandidates, std::numeric_limits<double>::infinity());
+    distances.resize(numCandidates);
+
+    std::vector<int>& chosen = workspace.clusterSizes;  // reused as the list of chosen candidate slots
+    chosen.clear();
+    size_t next = std::uniform_int_distribution<size_t>(0, numCandidates - 1)(rng);
+    while (true) {
+        chosen.push_back(next);
+        if ((int)chosen.size() == numClusters)
+            break;
+        computeDistances(candidateXs.data(), candidateYs.data(), numCandidates, candidateXs[next], candidateYs[next], distances.data());
+        double total = 0;
+        for (size_t j = 0; j < numCandidates; j++) {
+            closest[j] = std::min(closest[j], distances[j]);
+            total += closest[j];
+        }
+        if (total <= 0) {
+            // All remaining candidates coincide with a CH, take any unused one
+            std::vector<char> taken(numCandidates);
+            for (int slot : chosen)
+                taken[slot] = 1;
+            next = std::find(taken.begin(), taken.end(), 0) - taken.begin();
+            continue;
+        }
+        // Chosen candidates have no weight; if rounding leaves target >= 0 after
+        // the sweep, the last candidate with weight is taken
+        double target = std::uniform_real_distribution<double>(0, total)(rng);
+        for (size_t j = 0; j < numCandidates; j++) {
+            if (closest[j] <= 0)
+                continue;
+            next = j;
+            target -= closest[j];
+            if (target < 0)
+                break;
+        }
+    }
+}
+
+double LeachClusterOptimizer::assignNodes(Workspace& workspace, const std::vector<int>& clusterHeads, std::vector<int>& assignment) const {
+    size_t numNodes = xs.size();
+    double *__restrict best = workspace.bestDistances.data();
+    int *__restrict labels = assignment.data();
+    const double *__restrict nodeXs = xs.data();
+    const double *__restrict nodeYs = ys.data();
+    std::fill(best, best + numNodes, std::numeric_limits<double>::infinity());
+
+    // Cluster-major order keeps the inner loop a branch-free sweep over the node arrays
+    for (size_t c = 0; c < clusterHeads.size(); c++) {
+        double x = nodeXs[clusterHeads[c]];
+        double y = nodeYs[clusterHeads[c]];
+        int label = c;
+        for (size_t i = 0; i < numNodes; i++) {
+            double dx = nodeXs[i] - x;
+            double dy = nodeYs[i] - y;
+            double distance = dx * dx + dy * dy;
+            bool closer = distance < best[i];
+            best[i] = closer ? distance : best[i];
+            labels[i] = closer ? label : labels[i];
+        }
+    }
+
+    double cost = 0;
+    for (size_t i = 0; i < numNodes; i++)
+        cost += best[i];
+    return cost;
+}
+
+bool LeachClusterOptimizer::moveClusterHeads(Workspace& workspace, const std::vector<int>& candidates, std::vector<int>& clusterHeads, const std::vector<int>& assignment) const {
+    size_t numNodes = xs.size();
+    size_t numClusters = clusterHeads.size();
+    workspace.centroidXs.assign(numClusters, 0);
+    workspace.centroidYs.assign(numClusters, 0);
+    workspace.clusterSizes.assign(numClusters, 0);
+    for (size_t i = 0; i < numNodes; i++) {
+        workspace.centroidXs[assignment[i]] += xs[i];
+        workspace.centroidYs[assignment[i]] += ys[i];
+        workspace.clusterSizes[assignment[i]]++;
+    }
+
+    // CHs of empty clusters stay where they are, the others snap to the
+    // nearest candidate not yet taken by another cluster
+    std::vector<char>& used = workspace.used;
+    used.assign(numNodes, 0);
+    for (size_t c = 0; c < numClusters; c++)
+        if (workspace.clusterSizes[c] == 0)
+            used[clusterHeads[c]] = 1;
+
+    size_t numCandidates = candidates.size();
+    std::vector<double>& distances = workspace.candidateDistances;
+    distances.resize(numCandidates);
+    bool changed = false;
+    for (size_t c = 0; c < numClusters; c++) {
+        if (workspace.clusterSizes[c] == 0)
+            continue;
+        double x = workspace.centroidXs[c] / workspace.clusterSizes[c];
+        double y = workspace.centroidYs[c] / workspace.clusterSizes[c];
+        for (size_t j = 0; j < numCandidates; j++) {
+            double dx = xs[candidates[j]] - x;
+            double dy = ys[candidates[j]] - y;
+            distances[j] = dx * dx + dy * dy;
+        }
+        int nearest = -1;
+        double nearestDistance = std::numeric_limits<double>::infinity();
+        for (size_t j = 0; j < numCandidates; j++) {
+            if (distances[j] < nearestDistance && !used[candidates[j]]) {
+                nearestDistance = distances[j];
+                nearest = candidates[j];
+            }
+        }
+        if (nearest != clusterHeads[c]) {
+            clusterHeads[c] = nearest;
+            changed = true;
+        }
+        used[nearest] = 1;
+    }
+    return changed;
+}
+
+LeachClusterOptimizer::Result LeachClusterOptimizer::run(const Parameters& parameters, const std::vector<int>& candidates, int restart) const {
+    Workspace workspace;
+    Result result;
+    result.restart = restart;
+    seedClusterHeads(workspace, candidates, parameters.numClusters, splitmix64(parameters.seed ^ splitmix64(restart)));
+    result.clusterHeads.reserve(parameters.numClusters);
+    for (int slot : workspace.clusterSizes)
+        result.clusterHeads.push_back(candidates[slot]);
+
+    workspace.bestDistances.resize(xs.size());
+    result.assignment.resize(xs.size());
+    result.cost = assignNodes(workspace, result.clusterHeads, result.assignment);
+    while (result.iterations < parameters.maxIterations) {
+        result.iterations++;
+        if (!moveClusterHeads(workspace, candidates, result.clusterHeads, result.assignment))
+            break;
+        result.cost = assignNodes(workspace, result.clusterHeads, result.assignment);
+    }
+    return result;
+}
+
+LeachClusterOptimizer::Result LeachClusterOptimizer::optimize(const Parameters& parameters) const {
+    if (xs.empty())
+        return Result();
+    std::vector<int> candidates = getCandidates(parameters.energyFloor);
+    Parameters clamped = parameters;
+    clamped.numClusters = std::max(1, std::min(parameters.numClusters, (int)candidates.size()));
+    int numRestarts = std::max(1, parameters.numRestarts);
+    int numThreads = parameters.numThreads > 0 ? parameters.numThreads : std::max(1u, std::thread::hardware_concurrency());
+    numThreads = std::min(numThreads, numRestarts);
+
+    std::vector<Result> results(numRestarts);
+    auto worker = [&] (int first) {
+        for (int restart = first; restart < numRestarts; restart += numThreads)
+            results[restart] = run(clamped, candidates, restart);
+    };
+    if (numThreads == 1) {
+        worker(0);
+    } else {
+        std::vector<std::thread> threads;
+        for (int t = 1; t < numThreads; t++)
+            threads.emplace_back(worker, t);
+        worker(0);
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    // Lowest cost wins, ties go to the lowest restart index
+    size_t best = 0;
+    for (size_t r = 1; r < results.size(); r++)
+        if (results[r].cost < results[best].cost)
+            best = r;
+    return std::move(results[best]);
+}
+
+} // namespace inet
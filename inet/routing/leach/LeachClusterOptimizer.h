@@ -0,0 +1,73 @@
+#ifndef __INET_LEACHCLUSTEROPTIMIZER_H__
+#define __INET_LEACHCLUSTEROPTIMIZER_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Plain C++ on purpose: the optimizer has no OMNeT++ or INET dependency, so
+// benchmarks/LeachClusterOptimizerBenchmark.cc can build it on its own.
+
+namespace inet {
+
+/**
+ * @brief Energy-constrained k-means partitioning for centralized LEACH (LEACH-C).
+ *
+ * Every iteration assigns each node to its nearest CH, moves each centroid
+ * to the mean of its cluster and snaps it back to the nearest CH candidate,
+ * i.e. a node with at least energyFloor times the average residual energy.
+ * Iterations stop when the CH set no longer changes.
+ *
+ * Positions are kept as separate coordinate arrays (structure of arrays) and
+ * the distance loops run over contiguous memory without branches, so the
+ * compiler vectorizes them. Independent restarts with k-means++ seeding run
+ * on several threads; the cheapest partition wins. Each restart derives its
+ * random generator from the seed and its own index, so the result does not
+ * depend on the number of threads.
+ */
+class LeachClusterOptimizer {
+  public:
+    struct Parameters {
+        int numClusters = 1;
+        double energyFloor = 1.0;
+        int maxIterations = 20;
+        int numRestarts = 1;
+        int numThreads = 1;     // 0 uses all hardware threads
+        uint64_t seed = 0;
+    };
+
+    struct Result {
+        std::vector<int> clusterHeads;  // node indices, one per cluster
+        std::vector<int> assignment;    // cluster index of every node
+        double cost = 0;                // sum of squared node-to-CH distances
+        int iterations = 0;
+        int restart = -1;               // restart that produced the result
+    };
+
+  private:
+    std::vector<double> xs;
+    std::vector<double> ys;
+    std::vector<double> energies;
+
+    struct Workspace;
+    Result run(const Parameters& parameters, const std::vector<int>& candidates, int restart) const;
+    void seedClusterHeads(Workspace& workspace, const std::vector<int>& candidates, int numClusters, uint64_t seed) const;
+    double assignNodes(Workspace& workspace, const std::vector<int>& clusterHeads, std::vector<int>& assignment) const;
+    bool moveClusterHeads(Workspace& workspace, const std::vector<int>& candidates, std::vector<int>& clusterHeads, const std::vector<int>& assignment) const;
+
+  public:
+    void clear();
+    void reserve(size_t numNodes);
+    void addNode(double x, double y, double energy);
+    size_t getNumNodes() const { return xs.size(); }
+
+    /** Returns the CH candidates, the nodes with at least energyFloor times the average energy. */
+    std::vector<int> getCandidates(double energyFloor) const;
+
+    /** Partitions the nodes; numClusters is clamped to [1, number of candidates]. */
+    Result optimize(const Parameters& parameters) const;
+};
+
+} // namespace inet
+
+#endif // __INET_LEACHCLUSTEROPTIMIZER_H__
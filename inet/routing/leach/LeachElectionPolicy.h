@@ -0,0 +1,135 @@
+#ifndef __INET_LEACHELECTIONPOLICY_H__
+#define __INET_LEACHELECTIONPOLICY_H__
+
+#include <algorithm>
+#include <cmath>
+
+namespace inet {
+
+/** Energy tier of a node, advanced nodes start with (1 + alpha) times the normal energy (SEP). */
+enum LeachEnergyClass { LEACH_ENERGY_NORMAL, LEACH_ENERGY_ADVANCED, LEACH_NUM_ENERGY_CLASSES };
+
+inline const char *getLeachEnergyClassName(LeachEnergyClass energyClass) {
+    return energyClass == LEACH_ENERGY_ADVANCED ? "advanced" : "normal";
+}
+
+/**
+ * @brief Inputs of the per-round CH election of one node.
+ */
+struct LeachElectionContext {
+    int round = 0;
+    double clusterHeadPercentage = 0;  // p
+    int intervalLength = 1;  // 1/p, the epoch after which every node may be CH again
+    bool wasCH = false;  // CH during the current epoch
+    int roundsNotCH = 0;  // consecutive rounds without CH duty
+    double residualEnergy = 0;  // J
+    double initialEnergy = 0;  // J, 0 if the node has no energy storage
+    int nodeIndex = 0;
+    int numNodes = 0;
+    LeachEnergyClass energyClass = LEACH_ENERGY_NORMAL;
+    double advancedFraction = 0;  // m, share of advanced nodes
+    double advancedEnergyFactor = 0;  // alpha, extra energy of advanced nodes
+};
+
+/**
+ * @brief CH election policies of Leach.
+ *
+ * A policy is a struct with static members, Leach::electClusterHead() picks
+ * the policy with a switch and calls the members of the selected struct
+ * directly, so the per-round path has no virtual calls:
+ *
+ *  - randomized: whether isElected() needs the uniform draw, policies
+ *    without it leave the RNG stream untouched
+ *  - getThreshold(): T(n) of the node in this round
+ *  - isElected(): the decision, given the threshold and the draw
+ *  - getEpochLength(): rounds after which wasCH is cleared
+ *
+ * New policies derive from LeachElectionPolicyBase and hide the members
+ * they change.
+ */
+struct LeachElectionPolicyBase {
+    static constexpr bool randomized = true;
+
+    static double getClassicThreshold(const LeachElectionContext& context) {
+        double p = context.clusterHeadPercentage;
+        return p / (1 - p * std::fmod(context.round, context.intervalLength));
+    }
+
+    static double getThreshold(const LeachElectionContext& context) { return getClassicThreshold(context); }
+
+    static bool isElected(const LeachElectionContext& context, double threshold, double randNo) {
+        return randNo < threshold && !context.wasCH;
+    }
+
+    static int getEpochLength(const LeachElectionContext& context) { return context.intervalLength; }
+};
+
+/** Heinzelman's T(n). */
+struct LeachClassicElection : public LeachElectionPolicyBase {
+};
+
+/**
+ * LEACH-DCHS: T(n) scaled by residual over initial energy. The second term
+ * restores the classic threshold for nodes that were not CH for 1/p rounds,
+ * so a uniformly drained network still elects CHs.
+ */
+struct LeachEnergyElection : public LeachElectionPolicyBase {
+    static double getThreshold(const LeachElectionContext& context) {
+        double threshold = getClassicThreshold(context);
+        if (context.initialEnergy <= 0)
+            return threshold;
+        double energyFraction = context.residualEnergy / context.initialEnergy;
+        return threshold * (energyFraction + std::min(context.roundsNotCH / context.intervalLength, 1) * (1 - energyFraction));
+    }
+};
+
+/**
+ * Deterministic quota: exactly round(p * numNodes) consecutive host indices
+ * are CHs in every round, the window moves on by its size each round.
+ */
+struct LeachQuotaElection : public LeachElectionPolicyBase {
+    static constexpr bool randomized = false;
+
+    static int getQuota(const LeachElectionContext& context) {
+        return std::max(1, (int)std::lround(context.clusterHeadPercentage * context.numNodes));
+    }
+
+    static double getThreshold(const LeachElectionContext& context) {
+        int quota = getQuota(context);
+        long first = (long)context.round * quota % context.numNodes;
+        long offset = (context.nodeIndex - first + context.numNodes) % context.numNodes;
+        return offset < quota ? 1 : 0;
+    }
+
+    static bool isElected(const LeachElectionContext& context, double threshold, double randNo) {
+        return threshold >= 1;
+    }
+};
+
+/**
+ * SEP (Stable Election Protocol): the CH probability is weighted by the
+ * energy class, p_nrm = p / (1 + alpha * m) and p_adv = p * (1 + alpha) / (1 + alpha * m),
+ * and each class has its own epoch of 1/p_x rounds. The average number of
+ * CHs per round stays p * n while advanced nodes serve proportionally more.
+ */
+struct LeachSepElection : public LeachElectionPolicyBase {
+    static double getClassPercentage(const LeachElectionContext& context) {
+        double scale = 1 + context.advancedEnergyFactor * context.advancedFraction;
+        if (context.energyClass == LEACH_ENERGY_ADVANCED)
+            return context.clusterHeadPercentage * (1 + context.advancedEnergyFactor) / scale;
+        return context.clusterHeadPercentage / scale;
+    }
+
+    static int getEpochLength(const LeachElectionContext& context) {
+        return std::max(1, (int)std::lround(1 / getClassPercentage(context)));
+    }
+
+    static double getThreshold(const LeachElectionContext& context) {
+        double p = getClassPercentage(context);
+        return p / (1 - p * (context.round % getEpochLength(context)));
+    }
+};
+
+} // namespace inet
+
+#endif // __INET_LEACHELECTIONPOLICY_H__
@@ -0,0 +1,107 @@
+#include "inet/routing/leach/LeachEventTrace.h"
+
+#include <cstring>
+
+#include "inet/routing/leach/LeachAddressRegistry.h"
+
+namespace inet {
+
+static const uint32_t TRACE_VERSION = 1;
+
+std::map<std::string, LeachEventTrace *> LeachEventTrace::traces;
+
+LeachEventTrace::LeachEventTrace(const std::string& fileName) : fileName(fileName) {
+    file = fopen(fileName.c_str(), "wb");
+    if (file == nullptr)
+        throw cRuntimeError("Cannot open event trace file '%s'", fileName.c_str());
+    buffer.reserve(BUFFER_RECORDS);
+
+    char magic[8] = { 'L', 'E', 'A', 'C', 'H', 'T', 'R', 'C' };
+    uint32_t recordSize = sizeof(LeachTraceRecord);
+    writeBlock(magic, sizeof(magic));
+    writeBlock(&TRACE_VERSION, sizeof(TRACE_VERSION));
+    writeBlock(&recordSize, sizeof(recordSize));
+}
+
+LeachEventTrace::~LeachEventTrace() {
+    if (file != nullptr)
+        close();
+}
+
+LeachEventTrace *LeachEventTrace::acquire(const char *fileName) {
+    LeachEventTrace *& trace = traces[fileName];
+    if (trace == nullptr)
+        trace = new LeachEventTrace(fileName);
+    trace->refCount++;
+    return trace;
+}
+
+void LeachEventTrace::release() {
+    if (--refCount > 0)
+        return;
+    traces.erase(fileName);
+    delete this;
+}
+
+void LeachEventTrace::writeBlock(const void *data, size_t size) {
+    if (fwrite(data, 1, size, file) != size)
+        throw cRuntimeError("Cannot write event trace file '%s'", fileName.c_str());
+    bytesWritten += size;
+}
+
+void LeachEventTrace::internNode(int32_t nodeId) {
+    if (nodeId < 0)
+        return;
+    if ((size_t)nodeId >= nodeNames.size())
+        nodeNames.resize(nodeId + 1);
+    if (nodeNames[nodeId].empty())
+        nodeNames[nodeId] = LeachAddressRegistry::getInstance().getNode(nodeId).name;
+}
+
+void LeachEventTrace::record(simtime_t time, int32_t srcNode, int32_t destNode, LeachTracePacket packet, LeachTraceDirection type, double energy, int state) {
+    internNode(srcNode);
+    internNode(destNode);
+
+    LeachTraceRecord entry;
+    memset(&entry, 0, sizeof(entry));
+    entry.time = time.dbl() * 1000;
+    entry.energy = energy;
+    entry.srcNode = srcNode;
+    entry.destNode = destNode;
+    entry.packet = packet;
+    entry.type = type;
+    entry.state = state;
+    buffer.push_back(entry);
+
+    if (buffer.size() >= BUFFER_RECORDS)
+        flush();
+}
+
+void LeachEventTrace::flush() {
+    if (!buffer.empty()) {
+        writeBlock(buffer.data(), buffer.size() * sizeof(LeachTraceRecord));
+        buffer.clear();
+    }
+    fflush(file);
+}
+
+void LeachEventTrace::close() {
+    flush();
+
+    uint64_t nameTableOffset = bytesWritten;
+    for (auto& name : nodeNames) {
+        uint32_t length = name.size();
+        writeBlock(&length, sizeof(length));
+        writeBlock(name.data(), length);
+    }
+    uint32_t nodeCount = nodeNames.size();
+    char magic[4] = { 'L', 'T', 'N', 'D' };
+    writeBlock(&nameTableOffset, sizeof(nameTableOffset));
+    writeBlock(&nodeCount, sizeof(nodeCount));
+    writeBlock(magic, sizeof(magic));
+
+    fclose(file);
+    file = nullptr;
+}
+
+} // namespace inet
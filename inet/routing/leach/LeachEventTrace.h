@@ -0,0 +1,85 @@
+#ifndef __INET_LEACHEVENTTRACE_H__
+#define __INET_LEACHEVENTTRACE_H__
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "inet/common/INETDefs.h"
+
+namespace inet {
+
+enum LeachTracePacket : uint8_t { TRACE_CTRL = 0, TRACE_ACK, TRACE_SCH, TRACE_DATA, TRACE_BS, TRACE_BEACON, TRACE_STATUS, TRACE_ASSIGN };
+enum LeachTraceDirection : uint8_t { TRACE_SENT = 0, TRACE_REC };
+
+/** Node ids used in trace records besides the LeachAddressRegistry ids. */
+static const int32_t TRACE_NODE_BROADCAST = -1;
+static const int32_t TRACE_NODE_UNKNOWN = -2;
+
+/**
+ * One fixed-size record of the binary event trace, written in host byte
+ * order. Node ids refer to the name table at the end of the file.
+ */
+struct LeachTraceRecord {
+    double time;        // ms
+    double energy;      // residual capacity of the logging node, J
+    int32_t srcNode;
+    int32_t destNode;
+    uint8_t packet;     // LeachTracePacket
+    uint8_t type;       // LeachTraceDirection
+    uint8_t state;      // Leach::LeachState of the logging node
+    uint8_t reserved[5];
+};
+
+static_assert(sizeof(LeachTraceRecord) == 32, "LeachTraceRecord must stay 32 bytes");
+
+/**
+ * @brief Buffered binary event trace shared by all Leach instances writing the same file.
+ *
+ * Records are collected in a fixed-size buffer and written out in large
+ * blocks while the simulation runs, so memory use does not depend on the
+ * run length. The file starts with a header and ends with the table of the
+ * interned node names, followed by a footer:
+ *
+ *   header:  char magic[8] = "LEACHTRC", uint32 version, uint32 recordSize
+ *   records: LeachTraceRecord...
+ *   names:   per node id: uint32 length, char name[length]
+ *   footer:  uint64 nameTableOffset, uint32 nodeCount, char magic[4] = "LTND"
+ *
+ * Simulation/LeachProtocolSimulation/eventlog2csv.py converts it to the
+ * eventLog.csv format.
+ */
+class INET_API LeachEventTrace {
+  private:
+    static const size_t BUFFER_RECORDS = 32768;
+    static std::map<std::string, LeachEventTrace *> traces;
+
+    std::string fileName;
+    FILE *file = nullptr;
+    int refCount = 0;
+    uint64_t bytesWritten = 0;
+    std::vector<LeachTraceRecord> buffer;
+    std::vector<std::string> nodeNames;
+
+    explicit LeachEventTrace(const std::string& fileName);
+    ~LeachEventTrace();
+
+    void internNode(int32_t nodeId);
+    void writeBlock(const void *data, size_t size);
+    void close();
+
+  public:
+    /** Returns the trace writing fileName, opening it on first use. */
+    static LeachEventTrace *acquire(const char *fileName);
+    /** Drops one reference; the last one writes the name table and closes the file. */
+    void release();
+
+    void record(simtime_t time, int32_t srcNode, int32_t destNode, LeachTracePacket packet, LeachTraceDirection type, double energy, int state);
+    void flush();
+};
+
+} // namespace inet
+
+#endif // __INET_LEACHEVENTTRACE_H__
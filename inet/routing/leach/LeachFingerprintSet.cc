@@ -0,0 +1,84 @@
+#include "inet/routing/leach/LeachFingerprintSet.h"
+
+namespace inet {
+
+static inline uint64_t mix64(uint64_t key) {
+    // splitmix64 finalizer, spreads sequential keys over the whole table
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return key;
+}
+
+LeachFingerprintSet::LeachFingerprintSet(size_t expected) {
+    size_t capacity = 64;
+    while (capacity < 2 * expected)
+        capacity <<= 1;
+    rehash(capacity);
+}
+
+size_t LeachFingerprintSet::probe(uint64_t key) const {
+    size_t i = mix64(key) & mask;
+    while (slots[i].used && slots[i].key != key)
+        i = (i + 1) & mask;
+    return i;
+}
+
+void LeachFingerprintSet::rehash(size_t newCapacity) {
+    std::vector<Slot> old;
+    old.swap(slots);
+    slots.assign(newCapacity, Slot());
+    mask = newCapacity - 1;
+    count = 0;
+    for (auto& slot : old) {
+        if (slot.used) {
+            slots[probe(slot.key)] = slot;
+            count++;
+        }
+    }
+}
+
+bool LeachFingerprintSet::insert(uint64_t key) {
+    if (2 * (count + 1) > slots.size())
+        rehash(2 * slots.size());
+    Slot& slot = slots[probe(key)];
+    if (slot.used)
+        return false;
+    slot.key = key;
+    slot.epoch = epoch;
+    slot.used = true;
+    count++;
+    return true;
+}
+
+bool LeachFingerprintSet::contains(uint64_t key) const {
+    return slots[probe(key)].used;
+}
+
+void LeachFingerprintSet::advanceEpoch() {
+    epoch++;
+    if (retention == 0 || count == 0)
+        return;
+
+    // Linear probing has no cheap single-entry erase, so survivors are reinserted
+    std::vector<Slot> old;
+    old.swap(slots);
+    slots.assign(old.size(), Slot());
+    count = 0;
+    for (auto& slot : old) {
+        if (slot.used && epoch - slot.epoch < retention) {
+            slots[probe(slot.key)] = slot;
+            count++;
+        }
+    }
+}
+
+void LeachFingerprintSet::clear() {
+    for (auto& slot : slots)
+        slot.used = false;
+    count = 0;
+}
+
+} // namespace inet
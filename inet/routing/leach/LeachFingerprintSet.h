@@ -0,0 +1,59 @@
+#ifndef __INET_LEACHFINGERPRINTSET_H__
+#define __INET_LEACHFINGERPRINTSET_H__
+
+#include <cstdint>
+#include <vector>
+
+#include "inet/common/INETDefs.h"
+
+namespace inet {
+
+/**
+ * @brief Hashed set of packet ids with optional epoch eviction.
+ *
+ * Membership tests and insertions are O(1) (open addressing, linear
+ * probing). Every entry remembers the epoch it was inserted in; when a
+ * retention of N epochs is set, advanceEpoch() drops entries older than N
+ * epochs, which bounds memory in long runs. A retention of 0 keeps all
+ * entries for the lifetime of the set.
+ */
+class INET_API LeachFingerprintSet {
+  private:
+    struct Slot {
+        uint64_t key = 0;
+        uint32_t epoch = 0;
+        bool used = false;
+    };
+
+    std::vector<Slot> slots;
+    size_t mask = 0;
+    size_t count = 0;
+    uint32_t epoch = 0;
+    unsigned int retention = 0;
+
+    size_t probe(uint64_t key) const;
+    void rehash(size_t newCapacity);
+
+  public:
+    explicit LeachFingerprintSet(size_t expected = 64);
+
+    /** Number of epochs an entry is kept; 0 disables eviction. */
+    void setRetention(unsigned int epochs) { retention = epochs; }
+    unsigned int getRetention() const { return retention; }
+
+    /** Inserts key; returns false if it was already present. */
+    bool insert(uint64_t key);
+    bool contains(uint64_t key) const;
+
+    /** Starts a new epoch and evicts entries that fell out of the retention window. */
+    void advanceEpoch();
+    uint32_t getEpoch() const { return epoch; }
+
+    void clear();
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+};
+
+} // namespace inet
+
+#endif // __INET_LEACHFINGERPRINTSET_H__
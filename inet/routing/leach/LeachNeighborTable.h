@@ -0,0 +1,173 @@
+#ifndef __INET_LEACHNEIGHBORTABLE_H__
+#define __INET_LEACHNEIGHBORTABLE_H__
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "inet/common/INETDefs.h"
+#include "inet/networklayer/contract/ipv4/Ipv4Address.h"
+
+namespace inet {
+
+/**
+ * @brief Open-addressing (linear probing) hash map keyed by IPv4 address.
+ *
+ * Slots carry a generation tag, so clear() is O(1) and the table can be
+ * reused round after round without touching its storage. The table doubles
+ * when it becomes half full; entries are never erased individually.
+ */
+template<typename T>
+class LeachAddressMap {
+  private:
+    struct Slot {
+        uint32_t key = 0;
+        uint32_t generation = 0;
+        T value{};
+    };
+
+    std::vector<Slot> slots;
+    size_t mask = 0;
+    size_t count = 0;
+    uint32_t generation = 1;
+
+    static size_t hash(uint32_t key) {
+        key ^= key >> 16;
+        key *= 0x7feb352dU;
+        key ^= key >> 15;
+        key *= 0x846ca68bU;
+        key ^= key >> 16;
+        return key;
+    }
+
+    size_t probe(uint32_t key) const {
+        size_t i = hash(key) & mask;
+        while (slots[i].generation == generation && slots[i].key != key)
+            i = (i + 1) & mask;
+        return i;
+    }
+
+    void rehash(size_t newCapacity) {
+        std::vector<Slot> old;
+        old.swap(slots);
+        slots.assign(newCapacity, Slot());
+        mask = newCapacity - 1;
+        uint32_t oldGeneration = generation;
+        generation = 1;
+        for (auto& slot : old) {
+            if (slot.generation == oldGeneration) {
+                Slot& target = slots[probe(slot.key)];
+                target.key = slot.key;
+                target.generation = generation;
+                target.value = std::move(slot.value);
+            }
+        }
+    }
+
+  public:
+    explicit LeachAddressMap(size_t expected = 8) { reserve(expected); }
+
+    void reserve(size_t expected) {
+        size_t capacity = 16;
+        while (capacity < 2 * expected)
+            capacity <<= 1;
+        if (capacity > slots.size())
+            rehash(capacity);
+    }
+
+    T *find(const Ipv4Address& addr) {
+        Slot& slot = slots[probe(addr.getInt())];
+        return slot.generation == generation ? &slot.value : nullptr;
+    }
+
+    const T *find(const Ipv4Address& addr) const {
+        const Slot& slot = slots[probe(addr.getInt())];
+        return slot.generation == generation ? &slot.value : nullptr;
+    }
+
+    bool contains(const Ipv4Address& addr) const { return find(addr) != nullptr; }
+
+    /**
+     * Inserts value under addr unless the address is already present.
+     * Returns the stored value and whether an insertion took place.
+     */
+    std::pair<T *, bool> insert(const Ipv4Address& addr, const T& value) {
+        if (2 * (count + 1) > slots.size())
+            rehash(2 * slots.size());
+        Slot& slot = slots[probe(addr.getInt())];
+        if (slot.generation == generation)
+            return { &slot.value, false };
+        slot.key = addr.getInt();
+        slot.generation = generation;
+        slot.value = value;
+        count++;
+        return { &slot.value, true };
+    }
+
+    void clear() {
+        count = 0;
+        if (++generation == 0) {
+            // generation counter wrapped around, stale tags must not match again
+            for (auto& slot : slots)
+                slot.generation = 0;
+            generation = 1;
+        }
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+};
+
+/**
+ * @brief Per-round table of the cluster heads a node has heard.
+ *
+ * Keeps the received signal power of each CH advertisement in an
+ * address-keyed hash map and maintains the strongest CH incrementally, so
+ * both "is this CH known" and "which CH is ideal" are O(1).
+ */
+class INET_API LeachNeighborTable {
+  private:
+    LeachAddressMap<double> rxPowers;
+    Ipv4Address bestCH;
+    double bestRxPower = -1.0;
+
+  public:
+    explicit LeachNeighborTable(size_t expected = 8) : rxPowers(expected) {}
+
+    void reserve(size_t expected) { rxPowers.reserve(expected); }
+
+    /**
+     * Records the advertisement of CHAddr. Repeated advertisements of an
+     * already known CH are ignored; returns true if CHAddr was new.
+     */
+    bool add(const Ipv4Address& CHAddr, double rxPower) {
+        if (!rxPowers.insert(CHAddr, rxPower).second)
+            return false;
+        if (rxPower > bestRxPower) {
+            bestRxPower = rxPower;
+            bestCH = CHAddr;
+        }
+        return true;
+    }
+
+    bool contains(const Ipv4Address& CHAddr) const { return rxPowers.contains(CHAddr); }
+    const double *getRxPower(const Ipv4Address& CHAddr) const { return rxPowers.find(CHAddr); }
+
+    bool hasBestCH() const { return bestRxPower >= 0; }
+    const Ipv4Address& getBestCH() const { return bestCH; }
+    double getBestRxPower() const { return bestRxPower; }
+
+    void clear() {
+        rxPowers.clear();
+        bestCH = Ipv4Address();
+        bestRxPower = -1.0;
+    }
+
+    size_t size() const { return rxPowers.size(); }
+    bool empty() const { return rxPowers.empty(); }
+};
+
+} // namespace inet
+
+#endif // __INET_LEACHNEIGHBORTABLE_H__
+
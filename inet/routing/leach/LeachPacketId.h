@@ -0,0 +1,45 @@
+#ifndef __INET_LEACHPACKETID_H__
+#define __INET_LEACHPACKETID_H__
+
+#include <cstdint>
+
+namespace inet {
+
+/**
+ * @brief Compact identifier of a LEACH data packet.
+ *
+ * Packs the source node index, the round the packet was generated in and a
+ * per-round sequence number into one 64-bit value:
+ *
+ *   | source (20 bits) | round (20 bits) | sequence (24 bits) |
+ *
+ * Ids are generated and compared without allocation and are carried in the
+ * packetId field of LeachControlPkt.
+ */
+typedef uint64_t LeachPacketId;
+
+static const int LEACH_PACKETID_SOURCE_BITS = 20;
+static const int LEACH_PACKETID_ROUND_BITS = 20;
+static const int LEACH_PACKETID_SEQUENCE_BITS = 24;
+
+inline constexpr LeachPacketId makeLeachPacketId(uint32_t source, uint32_t round, uint32_t sequence) {
+    return ((LeachPacketId)(source & ((1U << LEACH_PACKETID_SOURCE_BITS) - 1)) << (LEACH_PACKETID_ROUND_BITS + LEACH_PACKETID_SEQUENCE_BITS))
+         | ((LeachPacketId)(round & ((1U << LEACH_PACKETID_ROUND_BITS) - 1)) << LEACH_PACKETID_SEQUENCE_BITS)
+         | (LeachPacketId)(sequence & ((1U << LEACH_PACKETID_SEQUENCE_BITS) - 1));
+}
+
+inline constexpr uint32_t getLeachPacketIdSource(LeachPacketId id) {
+    return (uint32_t)(id >> (LEACH_PACKETID_ROUND_BITS + LEACH_PACKETID_SEQUENCE_BITS));
+}
+
+inline constexpr uint32_t getLeachPacketIdRound(LeachPacketId id) {
+    return (uint32_t)(id >> LEACH_PACKETID_SEQUENCE_BITS) & ((1U << LEACH_PACKETID_ROUND_BITS) - 1);
+}
+
+inline constexpr uint32_t getLeachPacketIdSequence(LeachPacketId id) {
+    return (uint32_t)id & ((1U << LEACH_PACKETID_SEQUENCE_BITS) - 1);
+}
+
+} // namespace inet
+
+#endif // __INET_LEACHPACKETID_H__
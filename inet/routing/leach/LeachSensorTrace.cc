@@ -0,0 +1,153 @@
+#include "inet/routing/leach/LeachSensorTrace.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace inet {
+
+static const uint32_t SENSOR_TRACE_VERSION = 1;
+static const size_t SENSOR_TRACE_HEADER_SIZE = 24;
+
+std::map<std::string, LeachSensorTrace *> LeachSensorTrace::traces;
+
+LeachSensorTrace::LeachSensorTrace(const std::string& fileName) : fileName(fileName) {
+    map();
+
+    if (size < SENSOR_TRACE_HEADER_SIZE || memcmp(data, "LEACHSNS", 8) != 0) {
+        unmap();
+        throw cRuntimeError("'%s' is not a LEACH sensor trace", fileName.c_str());
+    }
+    uint32_t version;
+    memcpy(&version, data + 8, sizeof(version));
+    memcpy(&nodeCount, data + 12, sizeof(nodeCount));
+    memcpy(&rowCount, data + 16, sizeof(rowCount));
+    size_t expectedSize = SENSOR_TRACE_HEADER_SIZE + sizeof(uint64_t) * (nodeCount + 1) + 3 * sizeof(double) * rowCount;
+    if (version != SENSOR_TRACE_VERSION || size != expectedSize) {
+        unmap();
+        throw cRuntimeError("Unsupported sensor trace '%s' (version %u, %zu bytes, expected %zu)", fileName.c_str(), version, size, expectedSize);
+    }
+
+    // The header keeps every section 8-byte aligned, so the columns are used in place
+    rowOffsets = reinterpret_cast<const uint64_t *>(data + SENSOR_TRACE_HEADER_SIZE);
+    times = reinterpret_cast<const double *>(rowOffsets + nodeCount + 1);
+    temperatures = times + rowCount;
+    humidities = temperatures + rowCount;
+    // Checked once here, findFirst() and getTime() index the columns without bounds checks
+    bool validIndex = rowOffsets[0] == 0 && rowOffsets[nodeCount] == rowCount;
+    for (uint32_t node = 0; validIndex && node < nodeCount; node++)
+        validIndex = rowOffsets[node] <= rowOffsets[node + 1];
+    if (!validIndex) {
+        unmap();
+        throw cRuntimeError("Corrupt row index in sensor trace '%s'", fileName.c_str());
+    }
+}
+
+LeachSensorTrace::~LeachSensorTrace() {
+    unmap();
+}
+
+#ifdef _WIN32
+
+void LeachSensorTrace::map() {
+    HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw cRuntimeError("Cannot open sensor trace '%s'", fileName.c_str());
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        throw cRuntimeError("Cannot map empty sensor trace '%s'", fileName.c_str());
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void *view = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (view == nullptr) {
+        if (mapping != nullptr)
+            CloseHandle(mapping);
+        CloseHandle(file);
+        throw cRuntimeError("Cannot map sensor trace '%s'", fileName.c_str());
+    }
+    fileHandle = file;
+    mappingHandle = mapping;
+    data = static_cast<const char *>(view);
+    size = fileSize.QuadPart;
+}
+
+void LeachSensorTrace::unmap() {
+    if (data != nullptr)
+        UnmapViewOfFile(data);
+    if (mappingHandle != nullptr)
+        CloseHandle(mappingHandle);
+    if (fileHandle != nullptr)
+        CloseHandle(fileHandle);
+    data = nullptr;
+    mappingHandle = fileHandle = nullptr;
+}
+
+#else
+
+void LeachSensorTrace::map() {
+    fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw cRuntimeError("Cannot open sensor trace '%s'", fileName.c_str());
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+        close(fd);
+        throw cRuntimeError("Cannot map empty sensor trace '%s'", fileName.c_str());
+    }
+    void *view = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (view == MAP_FAILED) {
+        close(fd);
+        throw cRuntimeError("Cannot map sensor trace '%s'", fileName.c_str());
+    }
+    data = static_cast<const char *>(view);
+    size = fileStat.st_size;
+}
+
+void LeachSensorTrace::unmap() {
+    if (data != nullptr)
+        munmap(const_cast<char *>(data), size);
+    if (fd >= 0)
+        close(fd);
+    data = nullptr;
+    fd = -1;
+}
+
+#endif
+
+LeachSensorTrace *LeachSensorTrace::acquire(const char *fileName) {
+    LeachSensorTrace *& trace = traces[fileName];
+    if (trace == nullptr) {
+        try {
+            trace = new LeachSensorTrace(fileName);
+        }
+        catch (...) {
+            traces.erase(fileName);
+            throw;
+        }
+    }
+    trace->refCount++;
+    return trace;
+}
+
+void LeachSensorTrace::release() {
+    if (--refCount > 0)
+        return;
+    traces.erase(fileName);
+    delete this;
+}
+
+uint64_t LeachSensorTrace::findFirst(int node, double time) const {
+    const double *begin = times + getBegin(node);
+    const double *end = times + getEnd(node);
+    return std::lower_bound(begin, end, time) - times;
+}
+
+} // namespace inet
@@ -0,0 +1,79 @@
+#ifndef __INET_LEACHSENSORTRACE_H__
+#define __INET_LEACHSENSORTRACE_H__
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "inet/common/INETDefs.h"
+
+namespace inet {
+
+/**
+ * @brief Read-only, memory-mapped columnar sensor trace shared by all Leach instances.
+ *
+ * The file is mapped once per simulation and every node reads its readings
+ * straight from the mapping, so large traces are neither copied nor parsed
+ * per node. Rows are grouped by node and sorted by time within a node:
+ *
+ *   header:  char magic[8] = "LEACHSNS", uint32 version, uint32 nodeCount, uint64 rowCount
+ *   index:   uint64 rowOffset[nodeCount + 1], rows of node n are [rowOffset[n], rowOffset[n + 1])
+ *   columns: double time[rowCount] (s), double temperature[rowCount], double humidity[rowCount]
+ *
+ * All values are in host byte order. Node numbers are host indices.
+ * Simulation/LeachProtocolSimulation/csv2sensortrace.py creates the file
+ * from a time,node,temperature,humidity CSV.
+ */
+class INET_API LeachSensorTrace {
+  private:
+    static std::map<std::string, LeachSensorTrace *> traces;
+
+    std::string fileName;
+    int refCount = 0;
+
+    const char *data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    void *fileHandle = nullptr;
+    void *mappingHandle = nullptr;
+#else
+    int fd = -1;
+#endif
+
+    uint32_t nodeCount = 0;
+    uint64_t rowCount = 0;
+    const uint64_t *rowOffsets = nullptr;
+    const double *times = nullptr;
+    const double *temperatures = nullptr;
+    const double *humidities = nullptr;
+
+    explicit LeachSensorTrace(const std::string& fileName);
+    ~LeachSensorTrace();
+
+    void map();
+    void unmap();
+
+  public:
+    /** Returns the trace mapped from fileName, mapping it on first use. */
+    static LeachSensorTrace *acquire(const char *fileName);
+    /** Drops one reference; the last one unmaps the file. */
+    void release();
+
+    uint32_t getNodeCount() const { return nodeCount; }
+    uint64_t getRowCount() const { return rowCount; }
+
+    /** Rows of node are [getBegin(node), getEnd(node)); empty for nodes not in the trace. */
+    uint64_t getBegin(int node) const { return node >= 0 && (uint32_t)node < nodeCount ? rowOffsets[node] : 0; }
+    uint64_t getEnd(int node) const { return node >= 0 && (uint32_t)node < nodeCount ? rowOffsets[node + 1] : 0; }
+
+    /** Returns the first row of node at or after time, getEnd(node) if there is none. */
+    uint64_t findFirst(int node, double time) const;
+
+    double getTime(uint64_t row) const { return times[row]; }
+    double getTemperature(uint64_t row) const { return temperatures[row]; }
+    double getHumidity(uint64_t row) const { return humidities[row]; }
+};
+
+} // namespace inet
+
+#endif // __INET_LEACHSENSORTRACE_H__
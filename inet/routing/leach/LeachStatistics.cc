@@ -0,0 +1,186 @@
+#include "inet/routing/leach/LeachStatistics.h"
+#include "inet/power/contract/IEpEnergyStorage.h"
+
+#include <chrono>
+#include <climits>
+
+namespace inet {
+
+Define_Module(LeachStatistics);
+
+simsignal_t LeachStatistics::roundCHsSignal = registerSignal("roundCHs");
+simsignal_t LeachStatistics::clusterSizeSignal = registerSignal("clusterSize");
+simsignal_t LeachStatistics::aliveNodesSignal = registerSignal("aliveNodes");
+simsignal_t LeachStatistics::roundEnergyConsumedSignal = registerSignal("roundEnergyConsumed");
+
+static int countModules(cModule *module) {
+    int count = 1;
+    for (cModule::SubmoduleIterator it(module); !it.end(); ++it)
+        count += countModules(*it);
+    return count;
+}
+
+void LeachStatistics::Lifetime::nodeDown() {
+    numNodesDown++;
+    if (firstNodeDeadTime < 0)
+        firstNodeDeadTime = simTime();
+    if (halfNodesDeadTime < 0 && 2 * numNodesDown >= numNodes)
+        halfNodesDeadTime = simTime();
+}
+
+void LeachStatistics::Lifetime::record(cComponent *component, const char *suffix) const {
+    // Only reached lifetimes are recorded, a missing scalar means "beyond sim-time-limit"
+    if (firstNodeDeadTime >= 0)
+        component->recordScalar((std::string("firstNodeDead") + suffix).c_str(), firstNodeDeadTime, "s");
+    if (halfNodesDeadTime >= 0)
+        component->recordScalar((std::string("halfNodesDead") + suffix).c_str(), halfNodesDeadTime, "s");
+    component->recordScalar((std::string("#nodesAlive") + suffix).c_str(), numNodes - numNodesDown);
+    component->recordScalar((std::string("#chRounds") + suffix).c_str(), chRounds);
+}
+
+LeachStatistics::~LeachStatistics() {
+    cancelAndDelete(stopTimer);
+    cancelAndDelete(initTimer);
+}
+
+void LeachStatistics::initialize() {
+    stopOnFirstNodeDead = par("stopOnFirstNodeDead");
+    stopDeadFraction = par("stopDeadFraction");
+    stopSilentRounds = par("stopSilentRounds");
+    stopTimer = new cMessage("stop");
+    numModules = countModules(getSystemModule());
+    if (par("recordInitTime")) {
+        // Ahead of every other event at time 0, all stages of all modules are initialized by then
+        initTimer = new cMessage("initialized");
+        initTimer->setSchedulingPriority(INT_MIN);
+        scheduleAt(simTime(), initTimer);
+    }
+    WATCH(network.numNodes);
+    WATCH(network.numNodesDown);
+    WATCH(round);
+    WATCH(roundCHs);
+    WATCH(silentRounds);
+    // Declared before the nodes, so the initial capacities are seen as well
+    getSystemModule()->subscribe(power::IEpEnergyStorage::residualEnergyCapacityChangedSignal, this);
+}
+
+void LeachStatistics::handleMessage(cMessage *msg) {
+    if (msg == initTimer) {
+        initWallClock = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+        return;
+    }
+    if (msg != stopTimer)
+        throw cRuntimeError("LeachStatistics does not process messages");
+    EV_INFO << "Network lifetime reached (" << stopReason << "), ending the simulation" << endl;
+    endSimulation();
+}
+
+void LeachStatistics::stop(const char *reason) {
+    // Ends from an own event, not from within the lifecycle operation or packet that triggered it
+    if (stopTimer->isScheduled())
+        return;
+    stopReason = reason;
+    scheduleAt(simTime(), stopTimer);
+}
+
+void LeachStatistics::registerNode(LeachEnergyClass energyClass) {
+    network.numNodes++;
+    classes[energyClass].numNodes++;
+}
+
+void LeachStatistics::nodeDown(cModule *host, LeachEnergyClass energyClass) {
+    network.nodeDown();
+    classes[energyClass].nodeDown();
+    EV_INFO << host->getFullName() << " (" << getLeachEnergyClassName(energyClass) << ") is down, "
+            << getNumNodesAlive() << " of " << network.numNodes << " nodes alive" << endl;
+    if (stopOnFirstNodeDead)
+        stop("first node dead");
+    if (stopDeadFraction > 0 && deadFractionTime < 0 && network.numNodesDown >= stopDeadFraction * network.numNodes) {
+        deadFractionTime = simTime();
+        stop("dead fraction reached");
+    }
+    if (getNumNodesAlive() == 0) {
+        // No node starts another round, so close the open one here
+        if (roundOpen)
+            endRound();
+        if (stopSilentRounds > 0)
+            stop("all nodes dead");
+    }
+}
+
+void LeachStatistics::nodeUp(cModule *host, LeachEnergyClass energyClass) {
+    network.numNodesDown--;
+    classes[energyClass].numNodesDown--;
+}
+
+void LeachStatistics::clusterHeadElected(LeachEnergyClass energyClass) {
+    network.chRounds++;
+    classes[energyClass].chRounds++;
+    roundCHs++;
+}
+
+void LeachStatistics::roundStarted(int nodeRound) {
+    // Nodes start a round up to maxVariance apart, the first one closes the previous round
+    if (nodeRound <= round)
+        return;
+    if (roundOpen)
+        endRound();
+    round = nodeRound;
+    roundOpen = true;
+    if (stopSilentRounds > 0 && silentRounds >= stopSilentRounds)
+        stop("sinks silent");
+}
+
+void LeachStatistics::clusterFormed(int numMembers) {
+    emit(clusterSizeSignal, numMembers);
+}
+
+void LeachStatistics::endRound() {
+    EV_INFO << "Round " << round << ": " << roundCHs << " CHs, " << getNumNodesAlive() << " nodes alive, "
+            << roundEnergyConsumed << " J consumed" << endl;
+    emit(roundCHsSignal, roundCHs);
+    emit(aliveNodesSignal, getNumNodesAlive());
+    emit(roundEnergyConsumedSignal, roundEnergyConsumed);
+    silentRounds = roundAggregates == 0 ? silentRounds + 1 : 0;
+    roundCHs = 0;
+    roundEnergyConsumed = 0;
+    roundAggregates = 0;
+    roundOpen = false;
+}
+
+void LeachStatistics::receiveSignal(cComponent *source, simsignal_t signalID, double value, cObject *details) {
+    auto it = residualEnergies.find(source);
+    if (it == residualEnergies.end()) {
+        residualEnergies[source] = value;
+        return;
+    }
+    roundEnergyConsumed += it->second - value;
+    it->second = value;
+}
+
+void LeachStatistics::finish() {
+    // The last round has no successor to close it
+    if (roundOpen)
+        endRound();
+    recordScalar("#modules", numModules);
+    if (initWallClock >= 0)
+        recordScalar("initWallClock", initWallClock, "s");
+    network.record(this, "");
+    if (deadFractionTime >= 0)
+        recordScalar("deadFractionReached", deadFractionTime, "s");
+    if (!stopReason.empty()) {
+        recordScalar("stoppedAt", simTime(), "s");
+        recordScalar("#silentRounds", silentRounds);
+    }
+    // Per class only when the network is heterogeneous
+    if (classes[LEACH_ENERGY_ADVANCED].numNodes == 0)
+        return;
+    for (int i = 0; i < LEACH_NUM_ENERGY_CLASSES; i++) {
+        auto energyClass = static_cast<LeachEnergyClass>(i);
+        classes[i].record(this, (std::string(":") + getLeachEnergyClassName(energyClass)).c_str());
+        if (classes[i].numNodes > 0)
+            recordScalar((std::string("chRoundsPerNode:") + getLeachEnergyClassName(energyClass)).c_str(), (double)classes[i].chRounds / classes[i].numNodes);
+    }
+}
+
+} // namespace inet
@@ -0,0 +1,103 @@
+#ifndef __INET_LEACHSTATISTICS_H__
+#define __INET_LEACHSTATISTICS_H__
+
+#include "inet/common/INETDefs.h"
+#include "inet/routing/leach/LeachElectionPolicy.h"
+
+#include <unordered_map>
+
+namespace inet {
+
+/**
+ * @brief Collects network-wide LEACH statistics reported by the Leach instances.
+ *
+ * Network lifetime is recorded as the time of the first node going down
+ * (first node dead, FND) and of half of the nodes being down (half nodes
+ * dead, HND). Nodes go down when their energy management shuts them down
+ * at nodeShutdownCapacity, or by any other lifecycle operation. Lifetimes
+ * and CH duty are also recorded per energy class.
+ *
+ * Per-round values are accumulated as the nodes report them and emitted
+ * when the first node starts the next round, when the last node goes down
+ * or at the end of the simulation: the number of CHs, the alive
+ * nodes and the energy consumed by all nodes. The energy is summed from the
+ * residualEnergyCapacityChanged signals of the energy storages. Cluster
+ * sizes are emitted as each cluster closes its join window.
+ *
+ * Optionally the simulation ends once the network is considered dead: at
+ * the first node death, when a fraction of the nodes is down, or when no
+ * sink received an aggregate for a number of rounds (or all nodes are
+ * down, so that no further round can bring one). The conditions are
+ * checked as the events arrive, never by polling.
+ */
+class INET_API LeachStatistics : public cSimpleModule, public cListener {
+  private:
+    struct Lifetime {
+        int numNodes = 0;
+        int numNodesDown = 0;
+        simtime_t firstNodeDeadTime = -1;
+        simtime_t halfNodesDeadTime = -1;
+        int chRounds = 0;  // rounds served as CH, summed over the nodes
+
+        void nodeDown();
+        void record(cComponent *component, const char *suffix) const;
+    };
+
+    // Nodes may register before initialize() runs, so the counts are not reset there
+    Lifetime network;
+    Lifetime classes[LEACH_NUM_ENERGY_CLASSES];
+
+    // current round, -1 before the first one
+    int round = -1;
+    bool roundOpen = false;  // round started and not yet evaluated
+    int roundCHs = 0;
+    double roundEnergyConsumed = 0;  // J
+    std::unordered_map<const cComponent *, double> residualEnergies;  // last value per energy storage
+    int roundAggregates = 0;  // aggregates received by any sink in the current round
+    int silentRounds = 0;  // consecutive completed rounds without aggregates
+
+    // Stop conditions
+    bool stopOnFirstNodeDead = false;
+    double stopDeadFraction = 0;
+    int stopSilentRounds = 0;
+    simtime_t deadFractionTime = -1;
+    std::string stopReason;
+    cMessage *stopTimer = nullptr;
+
+    int numModules = 0;  // in the whole network, to compare node types
+    cMessage *initTimer = nullptr;  // first event after initialization, nullptr unless recordInitTime is set
+    double initWallClock = -1;  // s since the epoch
+
+    static simsignal_t roundCHsSignal;
+    static simsignal_t clusterSizeSignal;
+    static simsignal_t aliveNodesSignal;
+    static simsignal_t roundEnergyConsumedSignal;
+
+    void endRound();
+    void stop(const char *reason);
+
+  public:
+    virtual ~LeachStatistics();
+
+  protected:
+    virtual void initialize() override;
+    virtual void handleMessage(cMessage *msg) override;
+    virtual void finish() override;
+    virtual void receiveSignal(cComponent *source, simsignal_t signalID, double value, cObject *details) override;
+
+  public:
+    void registerNode(LeachEnergyClass energyClass);
+    void nodeDown(cModule *host, LeachEnergyClass energyClass);
+    void nodeUp(cModule *host, LeachEnergyClass energyClass);
+    void clusterHeadElected(LeachEnergyClass energyClass);
+    void roundStarted(int nodeRound);
+    void clusterFormed(int numMembers);
+    void aggregateReceived() { roundAggregates++; }
+
+    int getNumNodes() const { return network.numNodes; }
+    int getNumNodesAlive() const { return network.numNodes - network.numNodesDown; }
+};
+
+} // namespace inet
+
+#endif // __INET_LEACHSTATISTICS_H__